@@ -561,6 +561,49 @@ declare global {
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         getAllEntities(type: "peep"): Peep[];
+        /**
+         * Gets the main properties of all entities of the given type in one call. Each property is
+         * returned as a typed array with one value per entity, in the same order as the ids.
+         * This is much cheaper than getAllEntities when looking at every entity each tick.
+         * @param type The type of entity to query. Supports the same types as getAllEntities.
+         * @param options Optionally only includes entities within a range of the map.
+         */
+        queryEntities(type: EntityType, options?: EntityQueryOptions): EntityQueryResult;
+        queryEntities(type: "peep", options?: EntityQueryOptions): PeepQueryResult;
+    }
+
+    interface EntityQueryOptions {
+        /**
+         * Only include entities that are within this range, in map coordinates.
+         */
+        range?: MapRange;
+    }
+
+    interface EntityQueryResult {
+        /** The number of entities found, which is the length of every array. */
+        count: number;
+        id: Uint16Array;
+        x: Int32Array;
+        y: Int32Array;
+        z: Int32Array;
+    }
+
+    interface PeepQueryResult extends EntityQueryResult {
+        /** The internal state index of each peep, values are subject to change. */
+        state: Uint8Array;
+        energy: Uint8Array;
+        /** Guest only, 0 for staff. */
+        happiness: Uint8Array;
+        /** Guest only, 0 for staff. */
+        nausea: Uint8Array;
+        /** Guest only, 0 for staff. */
+        hunger: Uint8Array;
+        /** Guest only, 0 for staff. */
+        thirst: Uint8Array;
+        /** Guest only, 0 for staff. */
+        toilet: Uint8Array;
+        /** Guest only, 0 for staff. */
+        cash: Int32Array;
     }
 
     type TileElementType =
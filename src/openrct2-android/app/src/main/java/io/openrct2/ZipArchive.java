@@ -66,6 +66,16 @@ public class ZipArchive {
         return -1;
     }
 
+    public long getFileCrc(int index) {
+        ZipEntry entry = getZipEntry(index);
+
+        if (entry != null) {
+            return entry.getCrc();
+        }
+
+        return -1;
+    }
+
     public int getFileIndex(String path) {
         Enumeration<? extends ZipEntry> entries = _zipArchive.entries();
 
@@ -16,12 +16,14 @@
 #include <openrct2/config/Config.h>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/localisation/Localisation.h>
+#include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/scenario/Scenario.h>
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Sprite.h>
+#include <unordered_map>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_GUESTS;
@@ -64,6 +66,76 @@ static rct_widget window_guest_list_widgets[] = {
 };
 // clang-format on
 
+/**
+ * Formatted guest names, kept between refreshes of the list and between openings of the window as formatting the names
+ * of thousands of guests is most of the cost of building the list. A name is formatted again when the guest is renamed,
+ * its entity is reused by another guest, or the real names setting or the language changes.
+ */
+class GuestNameCache
+{
+private:
+    struct Entry
+    {
+        uint32_t PeepId{};
+        // Changes whenever the name is formatted, 0 when the entry is not valid
+        uint32_t Generation{};
+        std::string CustomName;
+        std::string Name;
+    };
+
+    std::vector<Entry> _entries;
+    uint32_t _nextGeneration = 1;
+    bool _realNames{};
+    int32_t _language = -1;
+
+public:
+    // Must be called before looking up names, drops all names if the way they are formatted has changed.
+    void Validate()
+    {
+        const bool realNames = (gParkFlags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+        const int32_t language = LocalisationService_GetCurrentLanguage();
+        if (_entries.empty() || realNames != _realNames || language != _language)
+        {
+            _entries.clear();
+            _entries.resize(MAX_ENTITIES);
+            _realNames = realNames;
+            _language = language;
+        }
+    }
+
+    const std::string& GetName(const Guest& guest)
+    {
+        return GetEntry(guest).Name;
+    }
+
+    uint32_t GetGeneration(const Guest& guest)
+    {
+        return GetEntry(guest).Generation;
+    }
+
+private:
+    const Entry& GetEntry(const Guest& guest)
+    {
+        auto& entry = _entries[guest.sprite_index];
+        const char* customName = guest.Name != nullptr ? guest.Name : "";
+        if (entry.Generation == 0 || entry.PeepId != guest.Id || entry.CustomName != customName)
+        {
+            char name[256]{};
+            Formatter ft;
+            guest.FormatNameTo(ft);
+            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
+
+            entry.PeepId = guest.Id;
+            entry.Generation = _nextGeneration++;
+            entry.CustomName = customName;
+            entry.Name = name;
+        }
+        return entry;
+    }
+};
+
+static GuestNameCache _guestNameCache;
+
 class GuestListWindow final : public Window
 {
 private:
@@ -97,16 +169,30 @@ private:
             return firstStrId;
         }
 
-        bool operator==(const FilterArguments& other)
+        bool operator==(const FilterArguments& other) const
         {
             return std::memcmp(args, other.args, sizeof(args)) == 0;
         }
-        bool operator!=(const FilterArguments& other)
+        bool operator!=(const FilterArguments& other) const
         {
             return !(*this == other);
         }
     };
 
+    struct FilterArgumentsHash
+    {
+        size_t operator()(const FilterArguments& arguments) const
+        {
+            // FNV-1a
+            uint32_t hash = 2166136261u;
+            for (auto b : arguments.args)
+            {
+                hash = (hash ^ b) * 16777619u;
+            }
+            return hash;
+        }
+    };
+
     struct GuestGroup
     {
         size_t NumGuests{};
@@ -119,7 +205,9 @@ private:
         using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
         uint16_t Id;
-        char Name[256];
+        // Generation of the cached name this item was created with
+        uint32_t NameGeneration;
+        std::string Name;
     };
 
     static constexpr const uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
@@ -141,6 +229,7 @@ private:
     uint32_t _lastFindGroupsTick{};
     uint32_t _lastFindGroupsWait{};
     std::vector<GuestGroup> _groups;
+    std::unordered_map<FilterArguments, size_t, FilterArgumentsHash> _groupIndices;
 
     std::vector<GuestItem> _guestList;
     std::optional<size_t> _highlightedIndex;
@@ -608,8 +697,11 @@ public:
         }
         else
         {
-            _guestList.clear();
+            _guestNameCache.Validate();
 
+            // Name generation of every guest that should be listed, 0 for the others
+            std::vector<uint32_t> visibleGenerations(MAX_ENTITIES);
+            std::vector<const Guest*> visibleGuests;
             for (auto peep : EntityList<Guest>())
             {
                 sprite_set_flashing(peep, false);
@@ -624,15 +716,36 @@ public:
                 if (!GuestShouldBeVisible(*peep))
                     continue;
 
+                visibleGenerations[peep->sprite_index] = _guestNameCache.GetGeneration(*peep);
+                visibleGuests.push_back(peep);
+            }
+
+            // Keep the items of guests that are still listed under the same name, which leaves the list sorted
+            auto keptEnd = std::remove_if(_guestList.begin(), _guestList.end(), [&visibleGenerations](const GuestItem& item) {
+                return visibleGenerations[item.Id] != item.NameGeneration;
+            });
+            _guestList.erase(keptEnd, _guestList.end());
+            for (const auto& item : _guestList)
+            {
+                visibleGenerations[item.Id] = 0;
+            }
+
+            // Sort the guests that are new to the list and merge them in
+            const auto numKept = static_cast<std::ptrdiff_t>(_guestList.size());
+            for (const auto* peep : visibleGuests)
+            {
+                if (visibleGenerations[peep->sprite_index] == 0)
+                    continue;
+
                 auto& item = _guestList.emplace_back();
                 item.Id = peep->sprite_index;
-
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                item.NameGeneration = visibleGenerations[peep->sprite_index];
+                item.Name = _guestNameCache.GetName(*peep);
             }
 
-            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+            auto compareFunc = GetGuestCompareFunc();
+            std::sort(_guestList.begin() + numKept, _guestList.end(), compareFunc);
+            std::inplace_merge(_guestList.begin(), _guestList.begin() + numKept, _guestList.end(), compareFunc);
         }
     }
 
@@ -780,12 +893,8 @@ private:
 
         if (!_filterName.empty())
         {
-            char name[256]{};
-
-            Formatter ft;
-            peep.FormatNameTo(ft);
-            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-            if (strcasestr(name, _filterName.c_str()) == nullptr)
+            const auto& name = _guestNameCache.GetName(peep);
+            if (strcasestr(name.c_str(), _filterName.c_str()) == nullptr)
             {
                 return false;
             }
@@ -821,15 +930,14 @@ private:
 
     GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
     {
-        auto foundGroup = std::find_if(
-            std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) { return group.Arguments == arguments; });
-        if (foundGroup != std::end(_groups))
+        auto [it, added] = _groupIndices.try_emplace(arguments, _groups.size());
+        if (added)
         {
-            return *foundGroup;
+            auto& newGroup = _groups.emplace_back();
+            newGroup.Arguments = arguments;
+            return newGroup;
         }
-        auto& newGroup = _groups.emplace_back();
-        newGroup.Arguments = arguments;
-        return newGroup;
+        return _groups[it->second];
     }
 
     void RefreshGroups()
@@ -838,6 +946,7 @@ private:
         _lastFindGroupsSelectedView = _selectedView;
         _lastFindGroupsWait = 320;
         _groups.clear();
+        _groupIndices.clear();
 
         for (auto peep : EntityList<Guest>())
         {
@@ -945,7 +1054,7 @@ private:
                 }
             }
         }
-        return strlogicalcmp(a.Name, b.Name) < 0;
+        return strlogicalcmp(a.Name.c_str(), b.Name.c_str()) < 0;
     }
 
     static GuestItem::CompareFunc GetGuestCompareFunc()
@@ -198,6 +198,7 @@ static void window_track_list_close(rct_window* w)
     _loadedTrackDesign = nullptr;
     _trackDesignPreviewPixels.clear();
     _trackDesignPreviewPixels.shrink_to_fit();
+    OpenRCT2::GetContext()->GetTrackDesignRepository()->ClearPreviews();
 
     // Dispose track list
     for (auto& trackDesign : _trackDesigns)
@@ -800,7 +801,8 @@ static bool track_list_load_design_for_preview(utf8* path)
     _loadedTrackDesign = track_design_open(path);
     if (_loadedTrackDesign != nullptr)
     {
-        track_design_draw_preview(_loadedTrackDesign.get(), _trackDesignPreviewPixels.data());
+        auto repo = OpenRCT2::GetContext()->GetTrackDesignRepository();
+        repo->DrawPreview(path, *_loadedTrackDesign, _trackDesignPreviewPixels.data());
         return true;
     }
     return false;
@@ -53,6 +53,7 @@
 #include "platform/Crash.h"
 #include "platform/Platform2.h"
 #include "platform/platform.h"
+#include "ride/RideRatings.h"
 #include "ride/TrackDesignRepository.h"
 #include "scenario/Scenario.h"
 #include "scenario/ScenarioRepository.h"
@@ -162,6 +163,9 @@ namespace OpenRCT2
             // NOTE: We must shutdown all systems here before Instance is set back to null.
             //       If objects use GetContext() in their destructor things won't go well.
 
+            // Don't lose a park that is still being saved in the background
+            scenario_save_async_wait();
+
             GameActions::ClearQueue();
             network_close();
             window_close_all();
@@ -633,6 +637,10 @@ namespace OpenRCT2
                 gFirstTimeSaving = true;
                 game_fix_save_vars();
                 AutoCreateMapAnimations();
+                if (gConfigGeneral.recalculate_ride_ratings_on_load)
+                {
+                    ride_ratings_recalculate_all();
+                }
                 EntityTweener::Get().Reset();
                 gScreenAge = 0;
                 gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
@@ -614,7 +614,7 @@ void save_game_cmd(const utf8* name /* = nullptr */)
 {
     if (name == nullptr)
     {
-        save_game_with_name(gScenarioSavePath.c_str());
+        save_game_with_name_async(gScenarioSavePath.c_str());
     }
     else
     {
@@ -622,7 +622,7 @@ void save_game_cmd(const utf8* name /* = nullptr */)
         platform_get_user_directory(savePath, "save", sizeof(savePath));
         safe_strcat_path(savePath, name, sizeof(savePath));
         path_append_extension(savePath, ".sv6", sizeof(savePath));
-        save_game_with_name(savePath);
+        save_game_with_name_async(savePath);
     }
 }
 
@@ -637,6 +637,24 @@ void save_game_with_name(const utf8* name)
     }
 }
 
+/**
+ * Like save_game_with_name, but the file is written in the background. Used for saves requested through the console,
+ * which on a server would otherwise stall every connected client. The park only counts as saved once the file has
+ * been written, failures are reported by scenario_save_async.
+ */
+void save_game_with_name_async(const utf8* name)
+{
+    log_verbose("Saving to %s", name);
+    scenario_save_async(
+        name, 0x80000000 | (gConfigGeneral.save_plugin_data ? 1 : 0), [path = std::string(name)](bool result) {
+            if (result)
+            {
+                gCurrentLoadedPath = path;
+                gScreenAge = 0;
+            }
+        });
+}
+
 void* create_save_game_as_intent()
 {
     char name[MAX_PATH];
@@ -762,7 +780,7 @@ void game_autosave()
         platform_file_copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
+    if (!scenario_save_async(path, saveFlags))
         Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
 }
 
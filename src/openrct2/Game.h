@@ -171,6 +171,7 @@ void* create_save_game_as_intent();
 void save_game_as();
 void save_game_cmd(const utf8* name = nullptr);
 void save_game_with_name(const utf8* name);
+void save_game_with_name_async(const utf8* name);
 void game_autosave();
 void game_convert_strings_to_utf8();
 void game_convert_strings_to_rct2(rct_s6_data* s6);
@@ -96,6 +96,7 @@ void GameState::Update()
     // 0x006E3AEC // screen_game_process_mouse_input();
     screenshot_check();
     game_handle_keyboard_input();
+    scenario_save_async_update();
 
     if (game_is_not_paused() && gPreviewingTitleSequenceInGame)
     {
@@ -366,6 +367,10 @@ void GameState::UpdateLogic(LogicTimings* timings)
         hookEngine.Call(HOOK_TYPE::INTERVAL_DAY, true);
     }
     report_time(LogicTimePart::Scripts);
+    if (timings != nullptr)
+    {
+        GetContext()->GetScriptEngine().GetPluginTimings(timings->ScriptTimings);
+    }
 #endif
 
     if (timings != nullptr)
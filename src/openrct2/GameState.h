@@ -14,7 +14,9 @@
 #include <array>
 #include <chrono>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace OpenRCT2
 {
@@ -54,10 +56,20 @@ namespace OpenRCT2
     using LogicTimingInfo = std::unordered_map<
         LogicTimePart, std::array<std::chrono::duration<double>, LOGIC_UPDATE_MEASUREMENTS_COUNT>>;
 
+    // Time spent in the callbacks a plugin registered for one hook, summed since the plugin was loaded
+    struct ScriptTimingInfo
+    {
+        std::string Plugin;
+        std::string Hook;
+        std::chrono::duration<double> Time{};
+        uint64_t NumCalls{};
+    };
+
     struct LogicTimings
     {
         LogicTimingInfo TimingInfo;
         size_t CurrentIdx{};
+        std::vector<ScriptTimingInfo> ScriptTimings;
     };
 
     /**
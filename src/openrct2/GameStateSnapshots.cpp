@@ -17,12 +17,23 @@
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
+// Every n-th captured snapshot starts a new delta chain, this bounds the number of snapshots that have to be applied
+// to rebuild the sprite list of a snapshot.
+static constexpr size_t SnapshotKeyframeInterval = 8;
+
+// Delta snapshots store the parts of an entity that changed in chunks of this size.
+static constexpr size_t SnapshotChunkSize = 16;
+static constexpr size_t SnapshotChunksPerSprite = sizeof(rct_sprite) / SnapshotChunkSize;
+static_assert(SnapshotChunksPerSprite <= 32, "Chunk mask must fit into 32 bits");
+
 struct GameStateSnapshot_t
 {
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
         storedSprites = std::move(mv.storedSprites);
+        isDelta = mv.isDelta;
+        baseSnapshot = std::move(mv.baseSnapshot);
         return *this;
     }
 
@@ -32,6 +43,104 @@ struct GameStateSnapshot_t
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
+    // When set, storedSprites only holds the chunks of each sprite that differ from baseSnapshot, or from an all zero
+    // sprite list if there is no base snapshot.
+    bool isDelta = false;
+    std::shared_ptr<const GameStateSnapshot_t> baseSnapshot;
+
+    // Stores the chunks of each sprite that differ from previousSprites and updates previousSprites to match.
+    void CaptureDelta(std::function<const rct_sprite*(const size_t)> getEntity, std::vector<rct_sprite>& previousSprites)
+    {
+        isDelta = true;
+        storedSprites.SetPosition(0);
+
+        uint32_t numChangedSprites = 0;
+        storedSprites.WriteValue(numChangedSprites);
+
+        for (size_t i = 0; i < previousSprites.size(); i++)
+        {
+            const auto* current = reinterpret_cast<const uint8_t*>(getEntity(i));
+            auto* previous = reinterpret_cast<uint8_t*>(&previousSprites[i]);
+            if (current == nullptr || std::memcmp(current, previous, sizeof(rct_sprite)) == 0)
+                continue;
+
+            uint32_t chunkMask = 0;
+            for (size_t chunk = 0; chunk < SnapshotChunksPerSprite; chunk++)
+            {
+                const size_t offset = chunk * SnapshotChunkSize;
+                if (std::memcmp(current + offset, previous + offset, SnapshotChunkSize) != 0)
+                {
+                    chunkMask |= 1u << chunk;
+                }
+            }
+
+            storedSprites.WriteValue(static_cast<uint16_t>(i));
+            storedSprites.WriteValue(chunkMask);
+            for (size_t chunk = 0; chunk < SnapshotChunksPerSprite; chunk++)
+            {
+                if (chunkMask & (1u << chunk))
+                {
+                    storedSprites.Write(current + chunk * SnapshotChunkSize, SnapshotChunkSize);
+                }
+            }
+            std::memcpy(previous, current, sizeof(rct_sprite));
+            numChangedSprites++;
+        }
+
+        storedSprites.SetPosition(0);
+        storedSprites.WriteValue(numChangedSprites);
+        storedSprites.SetPosition(storedSprites.GetLength());
+    }
+
+    // Applies the chunks stored by CaptureDelta to the sprite list of the base snapshot.
+    void ApplyDelta(std::vector<rct_sprite>& sprites) const
+    {
+        const auto* data = static_cast<const uint8_t*>(storedSprites.GetData());
+        const auto* dataEnd = data + storedSprites.GetLength();
+
+        uint32_t numChangedSprites = 0;
+        if (data + sizeof(numChangedSprites) > dataEnd)
+            return;
+        std::memcpy(&numChangedSprites, data, sizeof(numChangedSprites));
+        data += sizeof(numChangedSprites);
+
+        for (uint32_t i = 0; i < numChangedSprites; i++)
+        {
+            uint16_t spriteIndex = 0;
+            uint32_t chunkMask = 0;
+            if (data + sizeof(spriteIndex) + sizeof(chunkMask) > dataEnd)
+            {
+                log_error("Snapshot delta corrupted!");
+                return;
+            }
+            std::memcpy(&spriteIndex, data, sizeof(spriteIndex));
+            data += sizeof(spriteIndex);
+            std::memcpy(&chunkMask, data, sizeof(chunkMask));
+            data += sizeof(chunkMask);
+
+            if (spriteIndex >= sprites.size())
+            {
+                log_error("Entity index corrupted!");
+                return;
+            }
+
+            auto* sprite = reinterpret_cast<uint8_t*>(&sprites[spriteIndex]);
+            for (size_t chunk = 0; chunk < SnapshotChunksPerSprite; chunk++)
+            {
+                if (!(chunkMask & (1u << chunk)))
+                    continue;
+
+                if (data + SnapshotChunkSize > dataEnd)
+                {
+                    log_error("Snapshot delta corrupted!");
+                    return;
+                }
+                std::memcpy(sprite + chunk * SnapshotChunkSize, data, SnapshotChunkSize);
+                data += SnapshotChunkSize;
+            }
+        }
+    }
+
     // Must pass a function that can access the sprite.
     void SerialiseSprites(std::function<rct_sprite*(const size_t)> getEntity, const size_t numSprites, bool saving)
     {
@@ -122,11 +231,13 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _lastCapture = nullptr;
+        _lastCaptureSprites.clear();
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
     {
-        auto snapshot = std::make_unique<GameStateSnapshot_t>();
+        auto snapshot = std::make_shared<GameStateSnapshot_t>();
         _snapshots.push_back(std::move(snapshot));
 
         return *_snapshots.back();
@@ -140,12 +251,37 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
-        snapshot.SerialiseSprites(
-            [](const size_t index) { return reinterpret_cast<rct_sprite*>(GetEntity(index)); }, MAX_ENTITIES, true);
+        // Snapshots only store what changed since the previous capture, starting over from an empty sprite list
+        // every few captures.
+        if (_lastCapture == nullptr || _capturesSinceKeyframe >= SnapshotKeyframeInterval)
+        {
+            _lastCaptureSprites.assign(MAX_ENTITIES, rct_sprite());
+            _capturesSinceKeyframe = 0;
+            snapshot.baseSnapshot = nullptr;
+        }
+        else
+        {
+            _capturesSinceKeyframe++;
+            snapshot.baseSnapshot = _lastCapture;
+        }
+
+        snapshot.CaptureDelta(
+            [](const size_t index) { return reinterpret_cast<const rct_sprite*>(GetEntity(index)); }, _lastCaptureSprites);
+        _lastCapture = FindSnapshot(snapshot);
 
         // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
 
+    std::shared_ptr<GameStateSnapshot_t> FindSnapshot(const GameStateSnapshot_t& snapshot) const
+    {
+        for (size_t i = 0; i < _snapshots.size(); i++)
+        {
+            if (_snapshots[i].get() == &snapshot)
+                return _snapshots[i];
+        }
+        return nullptr;
+    }
+
     virtual const GameStateSnapshot_t* GetLinkedSnapshot(uint32_t tick) const override final
     {
         for (size_t i = 0; i < _snapshots.size(); i++)
@@ -160,12 +296,45 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
-        ds << snapshot.storedSprites;
+        if (ds.IsSaving() && snapshot.isDelta)
+        {
+            // Always write the full sprite list so that the receiving end does not need the delta chain.
+            auto spriteList = BuildSpriteList(snapshot);
+            GameStateSnapshot_t fullSnapshot;
+            fullSnapshot.SerialiseSprites(
+                [&spriteList](const size_t index) { return &spriteList[index]; }, spriteList.size(), true);
+            ds << fullSnapshot.storedSprites;
+        }
+        else
+        {
+            ds << snapshot.storedSprites;
+            if (ds.IsLoading())
+            {
+                snapshot.isDelta = false;
+                snapshot.baseSnapshot = nullptr;
+            }
+        }
         ds << snapshot.parkParameters;
     }
 
     std::vector<rct_sprite> BuildSpriteList(GameStateSnapshot_t& snapshot) const
     {
+        if (snapshot.isDelta)
+        {
+            std::vector<const GameStateSnapshot_t*> chain;
+            for (const GameStateSnapshot_t* delta = &snapshot; delta != nullptr; delta = delta->baseSnapshot.get())
+            {
+                chain.push_back(delta);
+            }
+
+            std::vector<rct_sprite> spriteList(MAX_ENTITIES);
+            for (auto it = chain.rbegin(); it != chain.rend(); it++)
+            {
+                (*it)->ApplyDelta(spriteList);
+            }
+            return spriteList;
+        }
+
         std::vector<rct_sprite> spriteList;
         spriteList.resize(MAX_ENTITIES);
 
@@ -558,6 +727,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
         std::vector<rct_sprite> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
         std::vector<rct_sprite> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+        res.spriteChanges.reserve(spritesBase.size());
 
         for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
         {
@@ -586,6 +756,11 @@ struct GameStateSnapshots final : public IGameStateSnapshots
                 // Do nothing.
                 changeData.changeType = GameStateSpriteChange_t::EQUAL;
             }
+            else if (std::memcmp(&spriteBase, &spriteCmp, sizeof(rct_sprite)) == 0)
+            {
+                // Identical bytes, no need to look at the individual fields.
+                changeData.changeType = GameStateSpriteChange_t::EQUAL;
+            }
             else
             {
                 CompareSpriteData(spriteBase, spriteCmp, changeData);
@@ -707,7 +882,12 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     }
 
 private:
-    CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+    CircularBuffer<std::shared_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+
+    // The most recent captured snapshot and its sprite list, the next capture is stored as a delta against it.
+    std::shared_ptr<const GameStateSnapshot_t> _lastCapture;
+    std::vector<rct_sprite> _lastCaptureSprites;
+    size_t _capturesSinceKeyframe = 0;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
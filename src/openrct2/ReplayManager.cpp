@@ -499,6 +499,26 @@ namespace OpenRCT2
             return true;
         }
 
+        virtual bool ReadGameActions(const std::string& file, std::vector<ReplayGameAction>& actions) override
+        {
+            auto replayData = std::make_unique<ReplayRecordData>();
+            if (!ReadReplayData(file, *replayData))
+            {
+                log_error("Unable to read replay data.");
+                return false;
+            }
+
+            auto& commands = replayData->commands;
+            actions.clear();
+            actions.reserve(commands.size());
+            while (!commands.empty())
+            {
+                auto node = commands.extract(commands.begin());
+                actions.push_back({ node.value().tick, std::move(node.value().action) });
+            }
+            return true;
+        }
+
     private:
         int ChecksumTicksDelta() const
         {
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 struct GameAction;
 
@@ -32,6 +33,12 @@ namespace OpenRCT2
         std::string FilePath;
     };
 
+    struct ReplayGameAction
+    {
+        uint32_t Tick;
+        std::unique_ptr<GameAction> Action;
+    };
+
     struct IReplayManager
     {
     public:
@@ -63,6 +70,9 @@ namespace OpenRCT2
         virtual bool StopPlayback() = 0;
 
         virtual bool NormaliseReplay(const std::string& inputFile, const std::string& outputFile) = 0;
+
+        // Reads the recorded game actions of a replay in the order they were recorded, without loading its park.
+        virtual bool ReadGameActions(const std::string& file, std::vector<ReplayGameAction>& actions) = 0;
     };
 
     std::unique_ptr<IReplayManager> CreateReplayManager();
@@ -26,6 +26,7 @@
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
+#include "GameActionQueue.h"
 
 #include <algorithm>
 #include <iterator>
@@ -83,35 +84,8 @@ namespace GameActions
         return message;
     }
 
-    struct QueuedGameAction
-    {
-        uint32_t tick;
-        uint32_t uniqueId;
-        GameAction::Ptr action;
-
-        explicit QueuedGameAction(uint32_t t, std::unique_ptr<GameAction>&& ga, uint32_t id)
-            : tick(t)
-            , uniqueId(id)
-            , action(std::move(ga))
-        {
-        }
-
-        bool operator<(const QueuedGameAction& comp) const
-        {
-            // First sort by tick
-            if (tick < comp.tick)
-                return true;
-            if (tick > comp.tick)
-                return false;
-
-            // If the ticks are equal sort by commandIndex
-            return uniqueId < comp.uniqueId;
-        }
-    };
-
     static GameActionFactory _actions[EnumValue(GameCommand::Count)];
-    static std::multiset<QueuedGameAction> _actionQueue;
-    static uint32_t _nextUniqueId = 0;
+    static GameActionQueue _actionQueue;
     static bool _suspended = false;
 
     GameActionFactory Register(GameCommand id, GameActionFactory factory)
@@ -158,7 +132,7 @@ namespace GameActions
             // as that normally happens when receiving them over network.
             ga->SetPlayer(network_get_current_player_id());
         }
-        _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
+        _actionQueue.Enqueue(tick, std::move(ga));
     }
 
     void ProcessQueue()
@@ -171,31 +145,30 @@ namespace GameActions
 
         const uint32_t currentTick = gCurrentTicks;
 
-        while (_actionQueue.begin() != _actionQueue.end())
+        while (!_actionQueue.IsEmpty())
         {
             // run all the game commands at the current tick
-            const QueuedGameAction& queued = *_actionQueue.begin();
+            if (network_get_mode() == NETWORK_MODE_CLIENT && _actionQueue.GetNextTick() > currentTick)
+            {
+                return;
+            }
+
+            // Taken off the queue before executing as executing the action can enqueue further actions
+            QueuedGameAction queued = _actionQueue.PopNext();
 
-            if (network_get_mode() == NETWORK_MODE_CLIENT)
+            if (network_get_mode() == NETWORK_MODE_CLIENT && queued.Tick < currentTick)
             {
-                if (queued.tick < currentTick)
-                {
-                    // This should never happen.
-                    Guard::Assert(
-                        false,
-                        "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
-                        "Tick: "
-                        "%08X\n",
-                        queued.action->GetName(), queued.action->GetType(), queued.uniqueId, queued.tick, currentTick);
-                }
-                else if (queued.tick > currentTick)
-                {
-                    return;
-                }
+                // This should never happen.
+                Guard::Assert(
+                    false,
+                    "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
+                    "Tick: "
+                    "%08X\n",
+                    queued.Action->GetName(), queued.Action->GetType(), queued.UniqueId, queued.Tick, currentTick);
             }
 
             // Remove ghost scenery so it doesn't interfere with incoming network command
-            switch (queued.action->GetType())
+            switch (queued.Action->GetType())
             {
                 case GameCommand::PlaceWall:
                 case GameCommand::PlaceLargeScenery:
@@ -207,7 +180,7 @@ namespace GameActions
                     break;
             }
 
-            GameAction* action = queued.action.get();
+            GameAction* action = queued.Action.get();
             action->SetFlags(action->GetFlags() | GAME_COMMAND_FLAG_NETWORKED);
 
             Guard::Assert(action != nullptr);
@@ -218,14 +191,12 @@ namespace GameActions
                 // Relay this action to all other clients.
                 network_send_game_action(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
     }
 
     void ClearQueue()
     {
-        _actionQueue.clear();
+        _actionQueue.Clear();
     }
 
     void Initialize()
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GameActionQueue.h"
+
+#include "../core/Guard.hpp"
+
+#include <algorithm>
+
+void GameActionQueue::Enqueue(uint32_t tick, GameAction::Ptr&& action)
+{
+    auto& bucket = GetBucket(tick);
+    bucket.Actions.push_back({ tick, _nextUniqueId++, std::move(action) });
+    _count++;
+}
+
+uint32_t GameActionQueue::GetNextTick() const
+{
+    Guard::Assert(!_buckets.empty());
+    return _buckets.front().Tick;
+}
+
+QueuedGameAction GameActionQueue::PopNext()
+{
+    Guard::Assert(!_buckets.empty());
+
+    auto& bucket = _buckets.front();
+    auto queued = std::move(bucket.Actions[bucket.Next]);
+    bucket.Next++;
+    _count--;
+
+    if (bucket.Next == bucket.Actions.size())
+    {
+        RecycleBucket(bucket);
+        _buckets.pop_front();
+    }
+    return queued;
+}
+
+void GameActionQueue::Clear()
+{
+    for (auto& bucket : _buckets)
+    {
+        RecycleBucket(bucket);
+    }
+    _buckets.clear();
+    _count = 0;
+}
+
+GameActionQueue::TickBucket& GameActionQueue::GetBucket(uint32_t tick)
+{
+    if (_buckets.empty() || _buckets.back().Tick < tick)
+    {
+        return _buckets.emplace_back(CreateBucket(tick));
+    }
+    if (_buckets.back().Tick == tick)
+    {
+        return _buckets.back();
+    }
+
+    // Action for an earlier tick than the newest one, rare enough to search for it.
+    auto it = std::lower_bound(
+        _buckets.begin(), _buckets.end(), tick, [](const TickBucket& bucket, uint32_t t) { return bucket.Tick < t; });
+    if (it != _buckets.end() && it->Tick == tick)
+    {
+        return *it;
+    }
+    return *_buckets.insert(it, CreateBucket(tick));
+}
+
+GameActionQueue::TickBucket GameActionQueue::CreateBucket(uint32_t tick)
+{
+    TickBucket bucket;
+    bucket.Tick = tick;
+    if (!_spareStorage.empty())
+    {
+        bucket.Actions = std::move(_spareStorage.back());
+        _spareStorage.pop_back();
+    }
+    return bucket;
+}
+
+void GameActionQueue::RecycleBucket(TickBucket& bucket)
+{
+    bucket.Actions.clear();
+    _spareStorage.push_back(std::move(bucket.Actions));
+}
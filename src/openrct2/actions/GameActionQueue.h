@@ -0,0 +1,69 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "GameAction.h"
+
+#include <deque>
+#include <vector>
+
+struct QueuedGameAction
+{
+    uint32_t Tick{};
+    uint32_t UniqueId{};
+    GameAction::Ptr Action;
+};
+
+/**
+ * Game actions waiting to be executed, ordered by tick and then by the order they were enqueued in. Actions are kept in
+ * one bucket per tick, nearly all actions are for the newest tick so enqueueing is usually a push to the last bucket.
+ */
+class GameActionQueue
+{
+private:
+    struct TickBucket
+    {
+        uint32_t Tick{};
+        size_t Next{};
+        std::vector<QueuedGameAction> Actions;
+    };
+
+    std::deque<TickBucket> _buckets;
+    // Storage of processed buckets, reused to avoid allocating for every tick
+    std::vector<std::vector<QueuedGameAction>> _spareStorage;
+    uint32_t _nextUniqueId{};
+    size_t _count{};
+
+public:
+    void Enqueue(uint32_t tick, GameAction::Ptr&& action);
+
+    bool IsEmpty() const
+    {
+        return _count == 0;
+    }
+
+    size_t GetCount() const
+    {
+        return _count;
+    }
+
+    // Tick of the next action, the queue must not be empty.
+    uint32_t GetNextTick() const;
+
+    // Removes and returns the next action, the queue must not be empty.
+    QueuedGameAction PopNext();
+
+    void Clear();
+
+private:
+    TickBucket& GetBucket(uint32_t tick);
+    TickBucket CreateBucket(uint32_t tick);
+    void RecycleBucket(TickBucket& bucket);
+};
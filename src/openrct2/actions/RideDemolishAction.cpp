@@ -310,6 +310,7 @@ money32 RideDemolishAction::DemolishTracks() const
 
             if (removRes->Error != GameActions::Status::Ok)
             {
+                map_invalidate_tile_full(location);
                 tile_element_remove(it.element);
             }
             else
@@ -32,6 +32,7 @@
 #include "../world/Scenery.h"
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
+#include "../world/TileSummary.h"
 #include "ParkSetLoanAction.h"
 #include "ParkSetParameterAction.h"
 
@@ -405,6 +406,7 @@ void SetCheatAction::FixVandalism() const
         it.element->AsPath()->SetIsBroken(false);
     } while (tile_element_iterator_next(&it));
 
+    map_invalidate_all_tile_summaries();
     gfx_invalidate_screen();
 }
 
@@ -225,5 +225,10 @@ GameActions::Result::Ptr TileModifyAction::QueryExecute(bool isExecuting) const
     res->Position.y = _loc.y;
     res->Position.z = tile_element_height(_loc);
 
+    if (isExecuting)
+    {
+        map_invalidate_path_wide_flags(_loc);
+    }
+
     return res;
 }
@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../ReplayManager.h"
+#    include "../actions/GameActionQueue.h"
+#    include "../platform/Platform2.h"
+#    include "../platform/platform.h"
+
+#    include <benchmark/benchmark.h>
+#    include <cstdint>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// Stream used when no replay is given, a few actions every tick like a busy multiplayer server
+static std::vector<ReplayGameAction> CreateSyntheticActionStream()
+{
+    constexpr uint32_t numTicks = 2000;
+    constexpr uint32_t actionsPerTick = 8;
+
+    std::vector<ReplayGameAction> actions;
+    actions.reserve(numTicks * actionsPerTick);
+    for (uint32_t tick = 0; tick < numTicks; tick++)
+    {
+        for (uint32_t i = 0; i < actionsPerTick; i++)
+        {
+            actions.push_back({ tick, GameActions::Create(GameCommand::TogglePause) });
+        }
+    }
+    return actions;
+}
+
+static bool LoadActionStream(
+    benchmark::State& state, IContext& context, const std::string& filename, std::vector<ReplayGameAction>& actions)
+{
+    if (!context.Initialise())
+    {
+        state.SkipWithError("Context initialization failed.");
+        return false;
+    }
+    if (filename.empty())
+    {
+        actions = CreateSyntheticActionStream();
+    }
+    else if (!context.GetReplayManager()->ReadGameActions(filename, actions))
+    {
+        state.SkipWithError("Failed to read replay!");
+        return false;
+    }
+    return true;
+}
+
+// Everything is enqueued before anything is processed, as happens during join storms and large batch builds
+static void BM_game_action_queue_batch(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    std::vector<ReplayGameAction> actions;
+    if (!LoadActionStream(state, *context, filename, actions))
+        return;
+
+    GameActionQueue queue;
+    for (auto _ : state)
+    {
+        for (auto& action : actions)
+        {
+            queue.Enqueue(action.Tick, std::move(action.Action));
+        }
+        // Actions come out in the order of the stream, so they can be put back for the next iteration
+        for (auto& action : actions)
+        {
+            action.Action = queue.PopNext().Action;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * actions.size());
+}
+
+// Actions are enqueued on the tick they were recorded for and processed at the end of the tick
+static void BM_game_action_queue_streamed(benchmark::State& state, const std::string& filename)
+{
+    std::unique_ptr<IContext> context(CreateContext());
+    std::vector<ReplayGameAction> actions;
+    if (!LoadActionStream(state, *context, filename, actions))
+        return;
+
+    GameActionQueue queue;
+    for (auto _ : state)
+    {
+        size_t next = 0;
+        size_t processed = 0;
+        while (next < actions.size())
+        {
+            const uint32_t tick = actions[next].Tick;
+            for (; next < actions.size() && actions[next].Tick == tick; next++)
+            {
+                queue.Enqueue(tick, std::move(actions[next].Action));
+            }
+            while (!queue.IsEmpty() && queue.GetNextTick() <= tick)
+            {
+                actions[processed++].Action = queue.PopNext().Action;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * actions.size());
+}
+
+static int CmdlineForBenchGameActionQueue(int argc, const char* const* argv)
+{
+    benchmark::RegisterBenchmark("batch/synthetic", BM_game_action_queue_batch, std::string{});
+    benchmark::RegisterBenchmark("streamed/synthetic", BM_game_action_queue_streamed, std::string{});
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract replay names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (Platform::FileExists(argv[i]))
+        {
+            benchmark::RegisterBenchmark((std::string("batch/") + argv[i]).c_str(), BM_game_action_queue_batch, argv[i]);
+            benchmark::RegisterBenchmark(
+                (std::string("streamed/") + argv[i]).c_str(), BM_game_action_queue_streamed, argv[i]);
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
+
+static exitcode_t HandleBenchGameActionQueue(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchGameActionQueue(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchGameActionQueue(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchGameActionQueueCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<replay>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchGameActionQueue),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchGameActionQueue), CommandTableEnd
+#endif // USE_BENCHMARK
+};
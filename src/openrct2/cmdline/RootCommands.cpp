@@ -136,12 +136,13 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
 
     // Sub-commands
-    DefineSubCommand("screenshot",      CommandLine::ScreenshotCommands       ),
-    DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
-    DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
-    DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
-    DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
-    DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("screenshot",       CommandLine::ScreenshotCommands           ),
+    DefineSubCommand("sprite",           CommandLine::SpriteCommands               ),
+    DefineSubCommand("benchgfx",         CommandLine::BenchGfxCommands             ),
+    DefineSubCommand("benchspritesort",  CommandLine::BenchSpriteSortCommands      ),
+    DefineSubCommand("benchsimulate",    CommandLine::BenchUpdateCommands          ),
+    DefineSubCommand("benchgameactions", CommandLine::BenchGameActionQueueCommands ),
+    DefineSubCommand("simulate",         CommandLine::SimulateCommands             ),
     CommandTableEnd
 };
 
@@ -226,6 +226,8 @@ namespace Config
             model->show_guest_purchases = reader->GetBoolean("show_guest_purchases", false);
             model->show_real_names_of_guests = reader->GetBoolean("show_real_names_of_guests", true);
             model->allow_early_completion = reader->GetBoolean("allow_early_completion", false);
+            model->converge_path_wide_flags = reader->GetBoolean("converge_path_wide_flags", false);
+            model->recalculate_ride_ratings_on_load = reader->GetBoolean("recalculate_ride_ratings_on_load", false);
             model->transparent_screenshot = reader->GetBoolean("transparent_screenshot", true);
             model->last_version_check_time = reader->GetInt64("last_version_check_time", 0);
         }
@@ -302,6 +304,8 @@ namespace Config
         writer->WriteBoolean("show_guest_purchases", model->show_guest_purchases);
         writer->WriteBoolean("show_real_names_of_guests", model->show_real_names_of_guests);
         writer->WriteBoolean("allow_early_completion", model->allow_early_completion);
+        writer->WriteBoolean("converge_path_wide_flags", model->converge_path_wide_flags);
+        writer->WriteBoolean("recalculate_ride_ratings_on_load", model->recalculate_ride_ratings_on_load);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->virtual_floor_style, Enum_VirtualFloorStyle);
         writer->WriteBoolean("transparent_screenshot", model->transparent_screenshot);
         writer->WriteInt64("last_version_check_time", model->last_version_check_time);
@@ -548,6 +552,7 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->time_budget = reader->GetInt32("time_budget", 0);
         }
     }
 
@@ -557,6 +562,7 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteInt32("time_budget", model->time_budget);
     }
 
     static bool SetDefaults()
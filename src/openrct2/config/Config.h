@@ -96,6 +96,8 @@ struct GeneralConfiguration
     bool steam_overlay_pause;
     bool show_real_names_of_guests;
     bool allow_early_completion;
+    bool converge_path_wide_flags;
+    bool recalculate_ride_ratings_on_load;
 
     // Loading and saving
     bool confirmation_prompt;
@@ -207,6 +209,7 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    int32_t time_budget;
 };
 
 enum class Sort : int32_t
@@ -43,6 +43,20 @@ namespace File
         return platform_file_move(srcPath.c_str(), dstPath.c_str());
     }
 
+    /**
+     * Moves srcPath over dstPath in one step, dstPath either keeps its old contents or has the new ones.
+     */
+    bool Replace(const std::string& srcPath, const std::string& dstPath)
+    {
+#ifdef _WIN32
+        auto wSrcPath = String::ToWideChar(srcPath);
+        auto wDstPath = String::ToWideChar(dstPath);
+        return MoveFileExW(wSrcPath.c_str(), wDstPath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+#else
+        return rename(srcPath.c_str(), dstPath.c_str()) == 0;
+#endif
+    }
+
     std::vector<uint8_t> ReadAllBytes(std::string_view path)
     {
 #if defined(_WIN32) && !defined(__MINGW32__)
@@ -21,6 +21,7 @@ namespace File
     bool Copy(const std::string& srcPath, const std::string& dstPath, bool overwrite);
     bool Delete(const std::string& path);
     bool Move(const std::string& srcPath, const std::string& dstPath);
+    bool Replace(const std::string& srcPath, const std::string& dstPath);
     std::vector<uint8_t> ReadAllBytes(std::string_view path);
     std::string ReadAllText(std::string_view path);
     std::vector<std::string> ReadAllLines(std::string_view path);
@@ -19,9 +19,9 @@
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -35,18 +35,33 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile> files)
             : Stats(stats)
             , Files(files)
         {
         }
     };
 
+    // An entry of the index file, files that did not produce an item are kept so they are not loaded again.
+    struct IndexedFile
+    {
+        ScannedFile File;
+        bool HasItem = false;
+        TItem Item;
+    };
+
     struct FileIndexHeader
     {
         uint32_t HeaderSize = sizeof(FileIndexHeader);
@@ -59,7 +74,7 @@ private:
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,30 +111,33 @@ public:
 
     /**
      * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * the items are loaded from the index and returned, otherwise the index is updated.
+     * Only files that were added or changed since the index was written are loaded again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
         auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
         if (std::get<0>(readIndexResult))
         {
             // Index was loaded
-            items = std::get<1>(readIndexResult);
+            return GetItems(std::get<1>(readIndexResult));
         }
-        else
+
+        // Index is out of date, reuse what is still valid
+        std::unordered_map<std::string, IndexedFile> previousFiles;
+        for (auto& indexedFile : std::get<1>(readIndexResult))
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            auto path = indexedFile.File.Path;
+            previousFiles.emplace(std::move(path), std::move(indexedFile));
         }
-        return items;
+        return Build(language, scanResult, std::move(previousFiles));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, {});
         return items;
     }
 
@@ -139,7 +157,7 @@ private:
     ScanResult Scan() const
     {
         DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<ScannedFile> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
@@ -159,7 +177,7 @@ private:
                 stats.FileDateModifiedChecksum = ror32(stats.FileDateModifiedChecksum, 5);
                 stats.PathChecksum += GetPathChecksum(path);
 
-                files.push_back(std::move(path));
+                files.push_back({ std::move(path), fileInfo->Size, fileInfo->LastModified });
             }
             delete scanner;
         }
@@ -167,13 +185,13 @@ private:
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const std::vector<size_t>& fileIndices, size_t rangeStart, size_t rangeEnd,
+        std::vector<IndexedFile>& indexedFiles, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& indexedFile = indexedFiles.at(fileIndices.at(i));
+            const auto& filePath = indexedFile.File.Path;
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
@@ -182,30 +200,59 @@ private:
             }
 
             auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            indexedFile.HasItem = std::get<0>(item);
+            if (indexedFile.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                indexedFile.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    /**
+     * Creates the items of all scanned files that are not in previousFiles with the same size and modification date,
+     * then writes the index.
+     */
+    std::vector<TItem> Build(
+        int32_t language, const ScanResult& scanResult, std::unordered_map<std::string, IndexedFile> previousFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::vector<IndexedFile> indexedFiles(scanResult.Files.size());
+        std::vector<size_t> filesToCreate;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto previousFile = previousFiles.find(file.Path);
+            if (previousFile != previousFiles.end() && previousFile->second.File.Size == file.Size
+                && previousFile->second.File.LastModified == file.LastModified)
+            {
+                indexedFiles[i] = std::move(previousFile->second);
+            }
+            else
+            {
+                indexedFiles[i].File = file;
+                filesToCreate.push_back(i);
+            }
+        }
+
+        const size_t totalCount = filesToCreate.size();
+        if (previousFiles.empty())
+        {
+            Console::WriteLine("Building %s (%zu items)", _name.c_str(), totalCount);
+        }
+        else
+        {
+            Console::WriteLine(
+                "Updating %s (%zu of %zu items changed)", _name.c_str(), totalCount, scanResult.Files.size());
+        }
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
         if (totalCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
@@ -222,36 +269,59 @@ private:
                     stepSize = totalCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    &FileIndex<TItem>::BuildRange, this, language, std::cref(filesToCreate), rangeStart,
+                    rangeStart + stepSize, std::ref(indexedFiles), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
-
-            for (const auto& itr : containers)
-            {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
-            }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, indexedFiles);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
         Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
 
-        return allItems;
+        return GetItems(indexedFiles);
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    static std::vector<TItem> GetItems(const std::vector<IndexedFile>& indexedFiles)
     {
-        bool loadedItems = false;
         std::vector<TItem> items;
+        items.reserve(indexedFiles.size());
+        for (const auto& indexedFile : indexedFiles)
+        {
+            if (indexedFile.HasItem)
+            {
+                items.push_back(indexedFile.Item);
+            }
+        }
+        return items;
+    }
+
+    void SerialiseIndexedFile(DataSerialiser& ds, IndexedFile& indexedFile) const
+    {
+        ds << indexedFile.File.Path;
+        ds << indexedFile.File.Size;
+        ds << indexedFile.File.LastModified;
+        ds << indexedFile.HasItem;
+        if (indexedFile.HasItem)
+        {
+            Serialise(ds, indexedFile.Item);
+        }
+    }
+
+    /**
+     * Reads the entries of the index file if it was written by the same version for the same language. Returns
+     * whether the directories have not changed since the index was written along with the entries.
+     */
+    std::tuple<bool, std::vector<IndexedFile>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    {
+        bool upToDate = false;
+        std::vector<IndexedFile> indexedFiles;
         if (File::Exists(_indexPath))
         {
             try
@@ -262,23 +332,23 @@ private:
                 // Read header, check if we need to re-scan
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    indexedFiles.reserve(header.NumItems);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
                     for (uint32_t i = 0; i < header.NumItems; i++)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        IndexedFile indexedFile;
+                        SerialiseIndexedFile(ds, indexedFile);
+                        indexedFiles.emplace_back(std::move(indexedFile));
                     }
-                    loadedItems = true;
+
+                    upToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
                 }
-                else
+                if (!upToDate)
                 {
                     Console::WriteLine("%s out of date", _name.c_str());
                 }
@@ -287,12 +357,13 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                indexedFiles.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return std::make_tuple(upToDate, std::move(indexedFiles));
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<IndexedFile>& indexedFiles) const
     {
         try
         {
@@ -307,14 +378,14 @@ private:
             header.VersionB = _version;
             header.LanguageId = language;
             header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
+            header.NumItems = static_cast<uint32_t>(indexedFiles.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
             // Write items
-            for (auto& item : items)
+            for (auto& indexedFile : indexedFiles)
             {
-                Serialise(ds, item);
+                SerialiseIndexedFile(ds, indexedFile);
             }
         }
         catch (const std::exception& e)
@@ -162,7 +162,7 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, uint32_t bandHeight, const ImageBandFunc& getBand)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -231,11 +231,15 @@ namespace Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            for (uint32_t top = 0; top < image.Height; top += bandHeight)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                auto numRows = std::min(bandHeight, image.Height - top);
+                auto pixels = getBand(top, numRows);
+                for (uint32_t y = 0; y < numRows; y++)
+                {
+                    png_write_row(png_ptr, const_cast<png_byte*>(pixels));
+                    pixels += image.Stride;
+                }
             }
 
             png_write_end(png_ptr, nullptr);
@@ -331,10 +335,23 @@ namespace Imaging
 
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format)
     {
+        auto pixels = image.Pixels.data();
+        WriteToFile(
+            path, image, std::max<uint32_t>(image.Height, 1), [pixels](uint32_t, uint32_t) { return pixels; }, format);
+    }
+
+    void WriteToFile(
+        std::string_view path, const Image& image, uint32_t bandHeight, const ImageBandFunc& getBand, IMAGE_FORMAT format)
+    {
+        if (bandHeight == 0)
+        {
+            throw std::invalid_argument("bandHeight can not be zero.");
+        }
+
         switch (format)
         {
             case IMAGE_FORMAT::AUTOMATIC:
-                WriteToFile(path, image, GetImageFormatFromPath(path));
+                WriteToFile(path, image, bandHeight, getBand, GetImageFormatFromPath(path));
                 break;
             case IMAGE_FORMAT::PNG:
             {
@@ -344,7 +361,7 @@ namespace Imaging
 #else
                 std::ofstream fs(std::string(path), std::ios::binary);
 #endif
-                WritePng(fs, image);
+                WritePng(fs, image, bandHeight, getBand);
                 break;
             }
             default:
@@ -44,12 +44,19 @@ struct Image
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
+// Returns rows top to top + numRows - 1 of an image that is written out a band at a time, laid out the same way as
+// Image::Pixels. The rows only need to stay valid until the next band is requested.
+using ImageBandFunc = std::function<const uint8_t*(uint32_t top, uint32_t numRows)>;
+
 namespace Imaging
 {
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
     Image ReadFromFile(std::string_view path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+    void WriteToFile(
+        std::string_view path, const Image& image, uint32_t bandHeight, const ImageBandFunc& getBand,
+        IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
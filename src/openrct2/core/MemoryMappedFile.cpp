@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "../Diagnostic.h"
+#include "FileStream.h"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+#include <string>
+
+namespace OpenRCT2
+{
+    MemoryMappedFile::MemoryMappedFile(std::string_view path)
+    {
+        if (Map(path))
+        {
+            _mapped = true;
+            return;
+        }
+
+        log_verbose("Unable to map %s into memory, reading it instead.", std::string(path).c_str());
+        auto fs = FileStream(std::string(path), FILE_MODE_OPEN);
+        _length = static_cast<size_t>(fs.GetLength());
+        _buffer = fs.ReadArray<uint8_t>(_length);
+        _data = _buffer.get();
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Unmap();
+    }
+
+#ifdef _WIN32
+    bool MemoryMappedFile::Map(std::string_view path)
+    {
+        auto pathW = String::ToWideChar(path);
+        auto hFile = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (hFile == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0
+            || static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+        {
+            CloseHandle(hFile);
+            return false;
+        }
+
+        auto hMapping = CreateFileMappingW(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (hMapping == nullptr)
+        {
+            CloseHandle(hFile);
+            return false;
+        }
+
+        auto view = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+        if (view == nullptr)
+        {
+            CloseHandle(hMapping);
+            CloseHandle(hFile);
+            return false;
+        }
+
+        _fileHandle = hFile;
+        _mappingHandle = hMapping;
+        _data = static_cast<uint8_t*>(view);
+        _length = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (_mapped)
+        {
+            UnmapViewOfFile(_data);
+            CloseHandle(_mappingHandle);
+            CloseHandle(_fileHandle);
+            _mapped = false;
+        }
+        _data = nullptr;
+        _length = 0;
+    }
+#else
+    bool MemoryMappedFile::Map(std::string_view path)
+    {
+        int fd = open(std::string(path).c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat statInfo;
+        if (fstat(fd, &statInfo) != 0 || statInfo.st_size <= 0 || static_cast<uint64_t>(statInfo.st_size) > SIZE_MAX)
+        {
+            close(fd);
+            return false;
+        }
+
+        auto length = static_cast<size_t>(statInfo.st_size);
+        auto view = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        close(fd);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        _data = static_cast<uint8_t*>(view);
+        _length = length;
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (_mapped)
+        {
+            munmap(_data, _length);
+            _mapped = false;
+        }
+        _data = nullptr;
+        _length = 0;
+    }
+#endif
+} // namespace OpenRCT2
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <memory>
+#include <string_view>
+
+namespace OpenRCT2
+{
+    /**
+     * Maps a whole file into memory so that its pages are only read from disk once they are touched. The view is
+     * copy-on-write, changes made through it stay private to the process and are never written back to the file.
+     * Platforms that can not map the file fall back to reading it into a buffer.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        uint8_t* _data{};
+        size_t _length{};
+        bool _mapped{};
+        std::unique_ptr<uint8_t[]> _buffer;
+#ifdef _WIN32
+        void* _fileHandle{};
+        void* _mappingHandle{};
+#endif
+
+    public:
+        explicit MemoryMappedFile(std::string_view path);
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+
+        bool IsMapped() const
+        {
+            return _mapped;
+        }
+
+    private:
+        bool Map(std::string_view path);
+        void Unmap();
+    };
+} // namespace OpenRCT2
@@ -127,6 +127,19 @@ public:
         }
     }
 
+    uint32_t GetFileCrc(size_t index) const override
+    {
+        zip_stat_t zipFileStat;
+        if (zip_stat_index(_zip, index, 0, &zipFileStat) == ZIP_ER_OK)
+        {
+            return zipFileStat.crc;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
         std::vector<uint8_t> result;
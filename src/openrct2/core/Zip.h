@@ -34,6 +34,7 @@ struct IZipArchive
     virtual size_t GetNumFiles() const abstract;
     virtual std::string GetFileName(size_t index) const abstract;
     virtual uint64_t GetFileSize(size_t index) const abstract;
+    virtual uint32_t GetFileCrc(size_t index) const abstract;
     virtual std::vector<uint8_t> GetFileData(std::string_view path) const abstract;
     virtual std::unique_ptr<OpenRCT2::IStream> GetFileStream(std::string_view path) const abstract;
 
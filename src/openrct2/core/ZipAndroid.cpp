@@ -97,6 +97,17 @@ public:
         return (size_t)env->CallLongMethod(_zip, fileSizeMethod, (jint)index);
     }
 
+    uint32_t GetFileCrc(size_t index) const override
+    {
+        // retrieve the JNI environment.
+        JNIEnv* env = (JNIEnv*)SDL_AndroidGetJNIEnv();
+
+        jclass zipClass = env->GetObjectClass(_zip);
+        jmethodID fileCrcMethod = env->GetMethodID(zipClass, "getFileCrc", "(I)J");
+
+        return (uint32_t)env->CallLongMethod(_zip, fileCrcMethod, (jint)index);
+    }
+
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
         // retrieve the JNI environment.
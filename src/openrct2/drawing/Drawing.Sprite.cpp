@@ -11,7 +11,7 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
-#include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
@@ -21,7 +21,10 @@
 #include "ScrollingText.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -66,61 +69,112 @@ static inline uint32_t rctc_to_rct2_index(uint32_t image)
     else if (image >= 28246                 ) return image - 49;
     else throw std::runtime_error("Invalid RCTC g1.dat file");
 }
+
+// RCTC's g1.dat has a number of additional elements added between the RCT2 elements, this skips over them.
+static inline uint32_t rct2_to_rctc_index(uint32_t image)
+{
+    if      (image <  1542) return image;
+    else if (image <  4951) return image + 32;
+    else if (image < 17154) return image + 35;
+    else if (image < 18084) return image + 37;
+    else if (image < 23761) return image + 39;
+    else if (image < 24627) return image + 43;
+    else if (image < 28197) return image + 47;
+    else                    return image + 49;
+}
 // clang-format on
 
-static void read_and_convert_gxdat(IStream* stream, size_t count, bool is_rctc, rct_g1_element* elements)
+void mask_scalar(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
 {
-    auto g1Elements32 = std::make_unique<rct_g1_element_32bit[]>(count);
-    stream->Read(g1Elements32.get(), count * sizeof(rct_g1_element_32bit));
-    if (is_rctc)
+    for (int32_t yy = 0; yy < height; yy++)
     {
-        // Process RCTC's g1.dat file
-        uint32_t rctc = 0;
-        for (size_t i = 0; i < SPR_G1_END; ++i)
+        for (int32_t xx = 0; xx < width; xx++)
         {
-            // RCTC's g1.dat has a number of additional elements
-            // added between the RCT2 elements. This switch
-            // statement skips over the elements we don't want.
-            switch (i)
+            uint8_t colour = (*colourSrc) & (*maskSrc);
+            if (colour != 0)
             {
-                case 1542:
-                    rctc += 32;
-                    break;
-                case 23761:
-                case 24627:
-                    rctc += 4;
-                    break;
-                case 4951:
-                    rctc += 3;
-                    break;
-                case 17154:
-                case 18084:
-                case 28197:
-                    rctc += 2;
-                    break;
+                *dst = colour;
             }
 
-            const rct_g1_element_32bit& src = g1Elements32[rctc];
+            maskSrc++;
+            colourSrc++;
+            dst++;
+        }
+        maskSrc += maskWrap;
+        colourSrc += colourWrap;
+        dst += dstWrap;
+    }
+}
 
-            // Double cast to silence compiler warning about casting to
-            // pointer from integer of mismatched length.
-            elements[i].offset = reinterpret_cast<uint8_t*>(static_cast<uintptr_t>(src.offset));
-            elements[i].width = src.width;
-            elements[i].height = src.height;
-            elements[i].x_offset = src.x_offset;
-            elements[i].y_offset = src.y_offset;
-            elements[i].flags = src.flags;
+// Element headers are converted in blocks of this many elements the first time one of them is requested
+constexpr size_t GxElementBlockSize = 256;
 
-            if (src.flags & G1_FLAG_HAS_ZOOM_SPRITE)
-            {
-                elements[i].zoomed_offset = static_cast<int32_t>(i - rctc_to_rct2_index(rctc - src.zoomed_offset));
-            }
-            else
-            {
-                elements[i].zoomed_offset = src.zoomed_offset;
-            }
+/**
+ * A graphics file mapped into memory. The pixel data is used straight from the mapping, so only the pages of sprites
+ * that are actually drawn are ever read from disk.
+ */
+struct MappedGx : rct_gx
+{
+    std::unique_ptr<MemoryMappedFile> headerFile;
+    // Only set when the element data is kept in a different file than the element headers
+    std::unique_ptr<MemoryMappedFile> dataFile;
+    const uint8_t* sourceElements{};
+    uint8_t* data{};
+    bool isRctc{};
+    bool isCsg{};
+    std::unique_ptr<std::atomic<bool>[]> convertedBlocks;
+    std::mutex convertMutex;
+};
+
+static MappedGx _g1;
+static MappedGx _g2;
+static MappedGx _csg;
+static rct_g1_element _scrollingText[MaxScrollingTextEntries]{};
+static bool _csgLoaded = false;
+
+static rct_g1_element _g1Temp = {};
+static std::vector<rct_g1_element> _imageListElements;
+bool gTinyFontAntiAliased = false;
 
-            ++rctc;
+static rct_g1_element_32bit read_source_element(const MappedGx& gx, size_t index)
+{
+    // The mapping makes no promises about alignment
+    rct_g1_element_32bit src;
+    std::memcpy(&src, gx.sourceElements + index * sizeof(rct_g1_element_32bit), sizeof(src));
+    return src;
+}
+
+static rct_g1_element convert_gx_element(const MappedGx& gx, size_t index)
+{
+    rct_g1_element element{};
+    size_t sourceIndex = index;
+    if (gx.isRctc)
+    {
+        // RCTC's g1.dat contains more elements than we use, anything past the RCT2 elements is left empty
+        if (index >= SPR_G1_END)
+        {
+            return element;
+        }
+        sourceIndex = rct2_to_rctc_index(static_cast<uint32_t>(index));
+    }
+
+    const auto src = read_source_element(gx, sourceIndex);
+    element.offset = gx.data + src.offset;
+    element.width = src.width;
+    element.height = src.height;
+    element.x_offset = src.x_offset;
+    element.y_offset = src.y_offset;
+    element.flags = src.flags;
+    element.zoomed_offset = src.zoomed_offset;
+
+    if (gx.isRctc)
+    {
+        if (src.flags & G1_FLAG_HAS_ZOOM_SPRITE)
+        {
+            element.zoomed_offset = static_cast<int32_t>(
+                index - rctc_to_rct2_index(static_cast<uint32_t>(sourceIndex - src.zoomed_offset)));
         }
 
         // The pincer graphic for picking up peeps is different in
@@ -128,65 +182,99 @@ static void read_and_convert_gxdat(IStream* stream, size_t count, bool is_rctc,
         // the change. This reverts the offsets to their RCT2 values.
         for (const auto& animation : sprite_peep_pickup_starts)
         {
-            for (int i = 0; i < SPR_PEEP_PICKUP_COUNT; ++i)
+            if (index >= static_cast<size_t>(animation.start)
+                && index < static_cast<size_t>(animation.start) + SPR_PEEP_PICKUP_COUNT)
             {
-                elements[animation.start + i].x_offset -= animation.x_offset;
-                elements[animation.start + i].y_offset -= animation.y_offset;
+                element.x_offset -= animation.x_offset;
+                element.y_offset -= animation.y_offset;
             }
         }
     }
-    else
+    else if (gx.isCsg && (src.flags & G1_FLAG_HAS_ZOOM_SPRITE))
     {
-        for (size_t i = 0; i < count; i++)
-        {
-            const rct_g1_element_32bit& src = g1Elements32[i];
-
-            // Double cast to silence compiler warning about casting to
-            // pointer from integer of mismatched length.
-            elements[i].offset = reinterpret_cast<uint8_t*>(static_cast<uintptr_t>(src.offset));
-            elements[i].width = src.width;
-            elements[i].height = src.height;
-            elements[i].x_offset = src.x_offset;
-            elements[i].y_offset = src.y_offset;
-            elements[i].flags = src.flags;
-            elements[i].zoomed_offset = src.zoomed_offset;
-        }
+        // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
+        element.zoomed_offset = static_cast<int32_t>(index - src.zoomed_offset);
     }
+    return element;
 }
 
-void mask_scalar(
-    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
-    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
+/**
+ * Returns the element at the given index, converting the block it lives in from the file first if nobody has asked
+ * for any of its elements yet. Safe to call from several drawing threads at once.
+ */
+static rct_g1_element* get_gx_element(MappedGx& gx, size_t index)
 {
-    for (int32_t yy = 0; yy < height; yy++)
+    auto& converted = gx.convertedBlocks[index / GxElementBlockSize];
+    if (!converted.load(std::memory_order_acquire))
     {
-        for (int32_t xx = 0; xx < width; xx++)
+        std::lock_guard<std::mutex> lock(gx.convertMutex);
+        if (!converted.load(std::memory_order_relaxed))
         {
-            uint8_t colour = (*colourSrc) & (*maskSrc);
-            if (colour != 0)
+            size_t blockStart = index - (index % GxElementBlockSize);
+            size_t blockEnd = std::min<size_t>(blockStart + GxElementBlockSize, gx.header.num_entries);
+            for (size_t i = blockStart; i < blockEnd; i++)
             {
-                *dst = colour;
+                gx.elements[i] = convert_gx_element(gx, i);
             }
-
-            maskSrc++;
-            colourSrc++;
-            dst++;
+            converted.store(true, std::memory_order_release);
         }
-        maskSrc += maskWrap;
-        colourSrc += colourWrap;
-        dst += dstWrap;
     }
+    return &gx.elements[index];
 }
 
-static rct_gx _g1 = {};
-static rct_gx _g2 = {};
-static rct_gx _csg = {};
-static rct_g1_element _scrollingText[MaxScrollingTextEntries]{};
-static bool _csgLoaded = false;
+static void unload_gx(MappedGx& gx)
+{
+    std::lock_guard<std::mutex> lock(gx.convertMutex);
+    gx.header = {};
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+    gx.convertedBlocks.reset();
+    gx.sourceElements = nullptr;
+    gx.data = nullptr;
+    gx.headerFile.reset();
+    gx.dataFile.reset();
+    gx.isRctc = false;
+    gx.isCsg = false;
+}
 
-static rct_g1_element _g1Temp = {};
-static std::vector<rct_g1_element> _imageListElements;
-bool gTinyFontAntiAliased = false;
+/**
+ * Sets up the element table of a mapped graphics file, the elements themselves are converted on demand by
+ * get_gx_element.
+ */
+static void map_gx_elements(MappedGx& gx, size_t elementsOffset, size_t dataOffset)
+{
+    if (gx.headerFile->GetLength() < elementsOffset + gx.header.num_entries * sizeof(rct_g1_element_32bit))
+    {
+        throw std::runtime_error("Graphics file is missing element headers");
+    }
+    const auto& dataFile = gx.dataFile != nullptr ? *gx.dataFile : *gx.headerFile;
+    if (dataFile.GetLength() < dataOffset + gx.header.total_size)
+    {
+        throw std::runtime_error("Graphics file is missing element data");
+    }
+
+    gx.sourceElements = gx.headerFile->GetData() + elementsOffset;
+    gx.data = dataFile.GetData() + dataOffset;
+    gx.elements.resize(gx.header.num_entries);
+
+    size_t numBlocks = (gx.header.num_entries + GxElementBlockSize - 1) / GxElementBlockSize;
+    gx.convertedBlocks = std::make_unique<std::atomic<bool>[]>(numBlocks);
+    for (size_t i = 0; i < numBlocks; i++)
+    {
+        gx.convertedBlocks[i] = false;
+    }
+}
+
+static rct_g1_header read_gx_header(const MemoryMappedFile& file)
+{
+    rct_g1_header header;
+    if (file.GetLength() < sizeof(header))
+    {
+        throw std::runtime_error("Graphics file is too small");
+    }
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    return header;
+}
 
 /**
  *
@@ -197,9 +285,11 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
     log_verbose("gfx_load_g1(...)");
     try
     {
+        unload_gx(_g1);
+
         auto path = Path::Combine(env.GetDirectoryPath(DIRBASE::RCT2, DIRID::DATA), "g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g1.header = fs.ReadValue<rct_g1_header>();
+        _g1.headerFile = std::make_unique<MemoryMappedFile>(path);
+        _g1.header = read_gx_header(*_g1.headerFile);
 
         log_verbose("g1.dat, number of entries: %u", _g1.header.num_entries);
 
@@ -208,26 +298,17 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
             throw std::runtime_error("Not enough elements in g1.dat");
         }
 
-        // Read element headers
+        // Element headers and data both live in g1.dat
         bool is_rctc = _g1.header.num_entries == SPR_RCTC_G1_END;
-        _g1.elements.resize(_g1.header.num_entries);
-        read_and_convert_gxdat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
+        _g1.isRctc = is_rctc;
+        size_t elementsOffset = sizeof(rct_g1_header);
+        map_gx_elements(_g1, elementsOffset, elementsOffset + _g1.header.num_entries * sizeof(rct_g1_element_32bit));
         gTinyFontAntiAliased = is_rctc;
-
-        // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g1.header.num_entries; i++)
-        {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
-        }
         return true;
     }
     catch (const std::exception&)
     {
-        _g1.elements.clear();
-        _g1.elements.shrink_to_fit();
+        unload_gx(_g1);
 
         log_fatal("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -241,23 +322,18 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    _g1.data.reset();
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    unload_gx(_g1);
 }
 
 void gfx_unload_g2()
 {
-    _g2.data.reset();
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    unload_gx(_g2);
 }
 
 void gfx_unload_csg()
 {
-    _csg.data.reset();
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    unload_gx(_csg);
+    _csgLoaded = false;
 }
 
 bool gfx_load_g2()
@@ -270,27 +346,17 @@ bool gfx_load_g2()
     safe_strcat_path(path, "g2.dat", MAX_PATH);
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g2.header = fs.ReadValue<rct_g1_header>();
-
-        // Read element headers
-        _g2.elements.resize(_g2.header.num_entries);
-        read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
-
-        // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        unload_gx(_g2);
 
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _g2.header.num_entries; i++)
-        {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
-        }
+        _g2.headerFile = std::make_unique<MemoryMappedFile>(path);
+        _g2.header = read_gx_header(*_g2.headerFile);
+        size_t elementsOffset = sizeof(rct_g1_header);
+        map_gx_elements(_g2, elementsOffset, elementsOffset + _g2.header.num_entries * sizeof(rct_g1_element_32bit));
         return true;
     }
     catch (const std::exception&)
     {
-        _g2.elements.clear();
-        _g2.elements.shrink_to_fit();
+        unload_gx(_g2);
 
         log_fatal("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -316,10 +382,12 @@ bool gfx_load_csg()
     auto pathDataPath = FindCsg1datAtLocation(gConfigGeneral.rct1_path);
     try
     {
-        auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
-        size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        unload_gx(_csg);
+
+        _csg.headerFile = std::make_unique<MemoryMappedFile>(pathHeaderPath);
+        _csg.dataFile = std::make_unique<MemoryMappedFile>(pathDataPath);
+        size_t fileHeaderSize = _csg.headerFile->GetLength();
+        size_t fileDataSize = _csg.dataFile->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(rct_g1_element_32bit));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -327,33 +395,18 @@ bool gfx_load_csg()
         if (!CsgIsUsable(_csg))
         {
             log_warning("Cannot load CSG1.DAT, it has too few entries. Only CSG1.DAT from Loopy Landscapes will work.");
+            unload_gx(_csg);
             return false;
         }
 
-        // Read element headers
-        _csg.elements.resize(_csg.header.num_entries);
-        read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
-
-        // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
-
-        // Fix entry data offsets
-        for (uint32_t i = 0; i < _csg.header.num_entries; i++)
-        {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
-            // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
-            if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
-            {
-                _csg.elements[i].zoomed_offset = i - _csg.elements[i].zoomed_offset;
-            }
-        }
+        _csg.isCsg = true;
+        map_gx_elements(_csg, 0, 0);
         _csgLoaded = true;
         return true;
     }
     catch (const std::exception&)
     {
-        _csg.elements.clear();
-        _csg.elements.shrink_to_fit();
+        unload_gx(_csg);
 
         log_error("Unable to load csg graphics");
         return false;
@@ -673,7 +726,7 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
     {
         if (offset < _g1.elements.size())
         {
-            return &_g1.elements[offset];
+            return get_gx_element(_g1, offset);
         }
     }
     else if (offset < SPR_G2_END)
@@ -681,7 +734,7 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
         size_t idx = offset - SPR_G2_BEGIN;
         if (idx < _g2.header.num_entries)
         {
-            return &_g2.elements[idx];
+            return get_gx_element(_g2, idx);
         }
         else
         {
@@ -695,7 +748,7 @@ const rct_g1_element* gfx_get_g1_element(int32_t image_id)
             size_t idx = offset - SPR_CSG_BEGIN;
             if (idx < _csg.header.num_entries)
             {
-                return &_csg.elements[idx];
+                return get_gx_element(_csg, idx);
             }
             else
             {
@@ -746,7 +799,7 @@ void gfx_set_g1_element(int32_t imageId, const rct_g1_element* g1)
             {
                 if (imageId < static_cast<int32_t>(_g1.elements.size()))
                 {
-                    _g1.elements[imageId] = *g1;
+                    *get_gx_element(_g1, imageId) = *g1;
                 }
             }
             else if (imageId < SPR_SCROLLING_TEXT_END)
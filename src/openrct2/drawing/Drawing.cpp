@@ -137,8 +137,8 @@ uint8_t gOtherPalette[256] = {
     0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
 };
 
-// Originally 0x9ABE04
-uint8_t text_palette[0x8] = {
+// Originally 0x9ABE04, per thread as paint workers draw money strings
+thread_local uint8_t text_palette[0x8] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
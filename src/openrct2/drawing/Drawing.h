@@ -99,7 +99,6 @@ struct rct_gx
 {
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
-    std::unique_ptr<uint8_t[]> data;
 };
 
 struct rct_drawpixelinfo
@@ -659,7 +658,7 @@ extern uint32_t gPaletteEffectFrame;
 extern const FilterPaletteID GlassPaletteIds[COLOUR_COUNT];
 extern uint8_t gPeepPalette[256];
 extern uint8_t gOtherPalette[256];
-extern uint8_t text_palette[];
+extern thread_local uint8_t text_palette[];
 extern const translucent_window_palette TranslucentWindowPalettes[COLOUR_COUNT];
 
 extern thread_local int32_t gLastDrawStringX;
@@ -11,15 +11,199 @@
 
 #include "../core/Imaging.h"
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace OpenRCT2::Drawing;
 using ImportResult = ImageImporter::ImportResult;
 
 constexpr int32_t PALETTE_TRANSPARENT = -1;
 
+/**
+ * Finds palette indices for colours without comparing the colour against every palette entry. The colour space is
+ * divided into cells, each cell lists the entries lying inside it and the changable entries that can be the closest to
+ * any colour in it. Candidates are checked in palette order with the same comparison as a full search, so the result
+ * is always the same as searching the whole palette.
+ */
+class ImageImporter::PaletteIndexLookup
+{
+private:
+    static constexpr int32_t CellShift = 3;
+    static constexpr int32_t CellSize = 1 << CellShift;
+    static constexpr int32_t CellsPerAxis = 256 / CellSize;
+
+    struct Cell
+    {
+        uint32_t ExactBegin{};
+        uint32_t ExactEnd{};
+        uint32_t ClosestBegin{};
+        uint32_t ClosestEnd{};
+    };
+
+    const GamePalette& _palette;
+    std::vector<Cell> _cells;
+    std::vector<uint8_t> _indices;
+
+public:
+    explicit PaletteIndexLookup(const GamePalette& palette)
+        : _palette(palette)
+    {
+        _cells.resize(CellsPerAxis * CellsPerAxis * CellsPerAxis);
+        for (int32_t r = 0; r < CellsPerAxis; r++)
+        {
+            for (int32_t g = 0; g < CellsPerAxis; g++)
+            {
+                for (int32_t b = 0; b < CellsPerAxis; b++)
+                {
+                    BuildCell(r, g, b);
+                }
+            }
+        }
+    }
+
+    const GamePalette& GetPalette() const
+    {
+        return _palette;
+    }
+
+    int32_t FindExact(const int16_t* colour) const
+    {
+        if (!IsInRange(colour))
+            return PALETTE_TRANSPARENT;
+
+        const auto& cell = GetCell(colour);
+        for (auto i = cell.ExactBegin; i < cell.ExactEnd; i++)
+        {
+            const auto& entry = _palette[_indices[i]];
+            if (entry.Red == colour[0] && entry.Green == colour[1] && entry.Blue == colour[2])
+            {
+                return _indices[i];
+            }
+        }
+        return PALETTE_TRANSPARENT;
+    }
+
+    int32_t FindClosest(const int16_t* colour) const
+    {
+        // Dithering can push colours out of range, they are rare enough to search the whole palette for
+        if (!IsInRange(colour))
+            return FindClosestSlow(colour);
+
+        const auto& cell = GetCell(colour);
+        auto smallestError = static_cast<uint32_t>(-1);
+        auto bestMatch = PALETTE_TRANSPARENT;
+        for (auto i = cell.ClosestBegin; i < cell.ClosestEnd; i++)
+        {
+            auto error = GetError(_palette[_indices[i]], colour);
+            if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
+            {
+                bestMatch = _indices[i];
+                smallestError = error;
+            }
+        }
+        return bestMatch;
+    }
+
+private:
+    static bool IsInRange(const int16_t* colour)
+    {
+        return colour[0] >= 0 && colour[0] <= 255 && colour[1] >= 0 && colour[1] <= 255 && colour[2] >= 0
+            && colour[2] <= 255;
+    }
+
+    static uint32_t GetError(const PaletteBGRA& entry, const int16_t* colour)
+    {
+        return (static_cast<int16_t>(entry.Red) - colour[0]) * (static_cast<int16_t>(entry.Red) - colour[0])
+            + (static_cast<int16_t>(entry.Green) - colour[1]) * (static_cast<int16_t>(entry.Green) - colour[1])
+            + (static_cast<int16_t>(entry.Blue) - colour[2]) * (static_cast<int16_t>(entry.Blue) - colour[2]);
+    }
+
+    // Smallest and largest squared distance between a channel value and the values of a cell
+    static std::pair<int32_t, int32_t> GetDistanceRange(int32_t value, int32_t cellMin)
+    {
+        const int32_t cellMax = cellMin + CellSize - 1;
+        const int32_t nearest = std::clamp(value, cellMin, cellMax);
+        const int32_t farthest = std::max(std::abs(value - cellMin), std::abs(value - cellMax));
+        return { (value - nearest) * (value - nearest), farthest * farthest };
+    }
+
+    const Cell& GetCell(const int16_t* colour) const
+    {
+        return _cells[GetCellIndex(colour[0] >> CellShift, colour[1] >> CellShift, colour[2] >> CellShift)];
+    }
+
+    static size_t GetCellIndex(int32_t r, int32_t g, int32_t b)
+    {
+        return (r * CellsPerAxis + g) * CellsPerAxis + b;
+    }
+
+    void BuildCell(int32_t r, int32_t g, int32_t b)
+    {
+        auto& cell = _cells[GetCellIndex(r, g, b)];
+
+        cell.ExactBegin = static_cast<uint32_t>(_indices.size());
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            const auto& entry = _palette[i];
+            if ((entry.Red >> CellShift) == r && (entry.Green >> CellShift) == g && (entry.Blue >> CellShift) == b)
+            {
+                _indices.push_back(static_cast<uint8_t>(i));
+            }
+        }
+        cell.ExactEnd = static_cast<uint32_t>(_indices.size());
+
+        // An entry can only be the closest to a colour in the cell if its smallest distance to the cell is not larger
+        // than the smallest of the largest distances of all entries to the cell.
+        std::vector<std::pair<int32_t, int32_t>> distances(PALETTE_SIZE);
+        int32_t bound = std::numeric_limits<int32_t>::max();
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            if (!IsChangablePixel(i))
+                continue;
+
+            const auto& entry = _palette[i];
+            auto [minR, maxR] = GetDistanceRange(entry.Red, r * CellSize);
+            auto [minG, maxG] = GetDistanceRange(entry.Green, g * CellSize);
+            auto [minB, maxB] = GetDistanceRange(entry.Blue, b * CellSize);
+            distances[i] = { minR + minG + minB, maxR + maxG + maxB };
+            bound = std::min(bound, distances[i].second);
+        }
+
+        cell.ClosestBegin = static_cast<uint32_t>(_indices.size());
+        for (int32_t i = 0; i < PALETTE_SIZE; i++)
+        {
+            if (IsChangablePixel(i) && distances[i].first <= bound)
+            {
+                _indices.push_back(static_cast<uint8_t>(i));
+            }
+        }
+        cell.ClosestEnd = static_cast<uint32_t>(_indices.size());
+    }
+
+    int32_t FindClosestSlow(const int16_t* colour) const
+    {
+        auto smallestError = static_cast<uint32_t>(-1);
+        auto bestMatch = PALETTE_TRANSPARENT;
+        for (int32_t x = 0; x < PALETTE_SIZE; x++)
+        {
+            if (IsChangablePixel(x))
+            {
+                auto error = GetError(_palette[x], colour);
+                if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
+                {
+                    bestMatch = x;
+                    smallestError = error;
+                }
+            }
+        }
+        return bestMatch;
+    }
+};
+
 ImportResult ImageImporter::Import(
     const Image& image, int32_t offsetX, int32_t offsetY, IMPORT_FLAGS flags, IMPORT_MODE mode) const
 {
@@ -215,18 +399,19 @@ std::vector<uint8_t> ImageImporter::EncodeRLE(const int32_t* pixels, uint32_t wi
 int32_t ImageImporter::CalculatePaletteIndex(
     IMPORT_MODE mode, int16_t* rgbaSrc, int32_t x, int32_t y, int32_t width, int32_t height)
 {
-    auto& palette = StandardPalette;
-    auto paletteIndex = GetPaletteIndex(palette, rgbaSrc);
+    const auto& lookup = GetStandardPaletteLookup();
+    const auto& palette = lookup.GetPalette();
+    auto paletteIndex = GetPaletteIndex(lookup, rgbaSrc);
     if (mode == IMPORT_MODE::CLOSEST || mode == IMPORT_MODE::DITHERING)
     {
         if (paletteIndex == PALETTE_TRANSPARENT && !IsTransparentPixel(rgbaSrc))
         {
-            paletteIndex = GetClosestPaletteIndex(palette, rgbaSrc);
+            paletteIndex = GetClosestPaletteIndex(lookup, rgbaSrc);
         }
     }
     if (mode == IMPORT_MODE::DITHERING)
     {
-        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc)))
+        if (!IsTransparentPixel(rgbaSrc) && IsChangablePixel(GetPaletteIndex(lookup, rgbaSrc)))
         {
             auto dr = rgbaSrc[0] - static_cast<int16_t>(palette[paletteIndex].Red);
             auto dg = rgbaSrc[1] - static_cast<int16_t>(palette[paletteIndex].Green);
@@ -234,7 +419,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
 
             if (x + 1 < width)
             {
-                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4)))
+                if (!IsTransparentPixel(rgbaSrc + 4) && IsChangablePixel(GetPaletteIndex(lookup, rgbaSrc + 4)))
                 {
                     // Right
                     rgbaSrc[4] += dr * 7 / 16;
@@ -248,7 +433,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x > 0)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width - 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width - 1))))
+                        && IsChangablePixel(GetPaletteIndex(lookup, rgbaSrc + 4 * (width - 1))))
                     {
                         // Bottom left
                         rgbaSrc[4 * (width - 1)] += dr * 3 / 16;
@@ -258,7 +443,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 }
 
                 // Bottom
-                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * width)))
+                if (!IsTransparentPixel(rgbaSrc + 4 * width) && IsChangablePixel(GetPaletteIndex(lookup, rgbaSrc + 4 * width)))
                 {
                     rgbaSrc[4 * width] += dr * 5 / 16;
                     rgbaSrc[4 * width + 1] += dg * 5 / 16;
@@ -268,7 +453,7 @@ int32_t ImageImporter::CalculatePaletteIndex(
                 if (x + 1 < width)
                 {
                     if (!IsTransparentPixel(rgbaSrc + 4 * (width + 1))
-                        && IsChangablePixel(GetPaletteIndex(palette, rgbaSrc + 4 * (width + 1))))
+                        && IsChangablePixel(GetPaletteIndex(lookup, rgbaSrc + 4 * (width + 1))))
                     {
                         // Bottom right
                         rgbaSrc[4 * (width + 1)] += dr * 1 / 16;
@@ -282,18 +467,17 @@ int32_t ImageImporter::CalculatePaletteIndex(
     return paletteIndex;
 }
 
-int32_t ImageImporter::GetPaletteIndex(const GamePalette& palette, int16_t* colour)
+const ImageImporter::PaletteIndexLookup& ImageImporter::GetStandardPaletteLookup()
+{
+    static const PaletteIndexLookup lookup(StandardPalette);
+    return lookup;
+}
+
+int32_t ImageImporter::GetPaletteIndex(const PaletteIndexLookup& lookup, int16_t* colour)
 {
     if (!IsTransparentPixel(colour))
     {
-        for (int32_t i = 0; i < PALETTE_SIZE; i++)
-        {
-            if (static_cast<int16_t>(palette[i].Red) == colour[0] && static_cast<int16_t>(palette[i].Green) == colour[1]
-                && static_cast<int16_t>(palette[i].Blue) == colour[2])
-            {
-                return i;
-            }
-        }
+        return lookup.FindExact(colour);
     }
     return PALETTE_TRANSPARENT;
 }
@@ -323,25 +507,7 @@ bool ImageImporter::IsChangablePixel(int32_t paletteIndex)
     return true;
 }
 
-int32_t ImageImporter::GetClosestPaletteIndex(const GamePalette& palette, const int16_t* colour)
+int32_t ImageImporter::GetClosestPaletteIndex(const PaletteIndexLookup& lookup, const int16_t* colour)
 {
-    auto smallestError = static_cast<uint32_t>(-1);
-    auto bestMatch = PALETTE_TRANSPARENT;
-    for (int32_t x = 0; x < PALETTE_SIZE; x++)
-    {
-        if (IsChangablePixel(x))
-        {
-            uint32_t error = (static_cast<int16_t>(palette[x].Red) - colour[0])
-                    * (static_cast<int16_t>(palette[x].Red) - colour[0])
-                + (static_cast<int16_t>(palette[x].Green) - colour[1]) * (static_cast<int16_t>(palette[x].Green) - colour[1])
-                + (static_cast<int16_t>(palette[x].Blue) - colour[2]) * (static_cast<int16_t>(palette[x].Blue) - colour[2]);
-
-            if (smallestError == static_cast<uint32_t>(-1) || smallestError > error)
-            {
-                bestMatch = x;
-                smallestError = error;
-            }
-        }
-    }
-    return bestMatch;
+    return lookup.FindClosest(colour);
 }
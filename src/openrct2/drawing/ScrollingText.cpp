@@ -21,25 +21,71 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <mutex>
+#include <thread>
 
 using namespace OpenRCT2;
 
-struct rct_draw_scroll_text
+// The cache is split into shards that each own a contiguous range of the entries and have their own lock, so paint
+// workers only contend when their text hashes to the same shard. Bitmaps are rendered outside of the lock.
+constexpr size_t ScrollingTextShardCount = 4;
+constexpr size_t ScrollingTextShardSize = MaxScrollingTextEntries / ScrollingTextShardCount;
+
+struct ScrollingTextKey
 {
     rct_string_id string_id;
     uint8_t string_args[32];
     colour_t colour;
     uint16_t position;
     uint16_t mode;
+
+    bool operator==(const ScrollingTextKey& other) const
+    {
+        return string_id == other.string_id && colour == other.colour && position == other.position && mode == other.mode
+            && std::memcmp(string_args, other.string_args, sizeof(string_args)) == 0;
+    }
+
+    uint32_t GetHash() const
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+        auto add = [&hash](const void* data, size_t len) {
+            auto bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < len; i++)
+            {
+                hash = (hash ^ bytes[i]) * 16777619u;
+            }
+        };
+        add(&string_id, sizeof(string_id));
+        add(string_args, sizeof(string_args));
+        add(&colour, sizeof(colour));
+        add(&position, sizeof(position));
+        add(&mode, sizeof(mode));
+        return hash;
+    }
+};
+
+struct rct_draw_scroll_text
+{
+    ScrollingTextKey key;
+    uint32_t hash;
     uint32_t id;
+    // Cleared while the bitmap is being rendered
+    std::atomic<bool> ready{ true };
     uint8_t bitmap[64 * 40];
 };
 
+struct ScrollingTextShard
+{
+    std::mutex mutex;
+    uint32_t nextId;
+};
+
 static rct_draw_scroll_text _drawScrollTextList[OpenRCT2::MaxScrollingTextEntries];
+static ScrollingTextShard _scrollingTextShards[ScrollingTextShardCount];
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
-static uint32_t _drawSCrollNextIndex = 0;
-static std::mutex _scrollingTextMutex;
 
 static void scrolling_text_set_bitmap_for_sprite(
     std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
@@ -134,41 +180,57 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     }
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(
-    rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+/**
+ * Returns the entry for key within the shard, the oldest entry of the shard is claimed when there is none. found tells
+ * which of the two it is. Must be called with the shard locked.
+ */
+static size_t scrolling_text_get_matching_or_oldest(
+    size_t shardIndex, const ScrollingTextKey& key, uint32_t hash, bool& found)
 {
+    auto& shard = _scrollingTextShards[shardIndex];
+    shard.nextId++;
+
+    const size_t begin = shardIndex * ScrollingTextShardSize;
     uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
-    for (size_t i = 0; i < std::size(_drawScrollTextList); i++)
+    size_t scrollIndex = begin;
+    for (size_t i = begin; i < begin + ScrollingTextShardSize; i++)
     {
         rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+        // Entries still being rendered by another worker can't be reused, a shard always holds more entries than there
+        // are paint workers so one that is ready is found
+        if (oldestId >= scrollText->id && scrollText->ready.load(std::memory_order_acquire))
         {
             oldestId = scrollText->id;
-            scrollIndex = static_cast<int32_t>(i);
+            scrollIndex = i;
         }
 
         // If exact match return the matching index
-        if (scrollText->string_id == stringId
-            && std::memcmp(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args)) == 0
-            && scrollText->colour == colour && scrollText->position == scroll && scrollText->mode == scrollingMode)
+        if (scrollText->hash == hash && scrollText->key == key)
         {
-            scrollText->id = _drawSCrollNextIndex;
-            return static_cast<int32_t>(i + SPR_SCROLLING_TEXT_START);
+            scrollText->id = shard.nextId;
+            found = true;
+            return i;
         }
     }
+
+    auto scrollText = &_drawScrollTextList[scrollIndex];
+    scrollText->key = key;
+    scrollText->hash = hash;
+    scrollText->id = shard.nextId;
+    scrollText->ready.store(false, std::memory_order_relaxed);
+    found = false;
     return scrollIndex;
 }
 
-static void scrolling_text_format(utf8* dst, size_t size, rct_draw_scroll_text* scrollText)
+static void scrolling_text_format(utf8* dst, size_t size, const ScrollingTextKey& key)
 {
     if (gConfigGeneral.upper_case_banners)
     {
-        format_string_to_upper(dst, size, scrollText->string_id, scrollText->string_args);
+        format_string_to_upper(dst, size, key.string_id, key.string_args);
     }
     else
     {
-        format_string(dst, size, scrollText->string_id, scrollText->string_args);
+        format_string(dst, size, key.string_id, key.string_args);
     }
 }
 
@@ -1442,16 +1504,15 @@ void scrolling_text_invalidate()
 {
     for (auto& scrollText : _drawScrollTextList)
     {
-        scrollText.string_id = 0;
-        std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
+        scrollText.key.string_id = 0;
+        std::memset(scrollText.key.string_args, 0, sizeof(scrollText.key.string_args));
+        scrollText.hash = 0;
     }
 }
 
 int32_t scrolling_text_setup(
     paint_session* session, rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
 {
-    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
-
     assert(scrollingMode < MAX_SCROLLING_TEXT_MODES);
 
     rct_drawpixelinfo* dpi = &session->DPI;
@@ -1459,24 +1520,38 @@ int32_t scrolling_text_setup(
     if (dpi->zoom_level > 0)
         return SPR_SCROLLING_TEXT_DEFAULT;
 
-    _drawSCrollNextIndex++;
     ft.Rewind();
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, ft, scroll, scrollingMode, colour);
-    if (scrollIndex >= SPR_SCROLLING_TEXT_START)
-        return scrollIndex;
+    ScrollingTextKey key{};
+    key.string_id = stringId;
+    std::memcpy(key.string_args, ft.Buf(), sizeof(key.string_args));
+    key.colour = colour;
+    key.position = scroll;
+    key.mode = scrollingMode;
+    const uint32_t hash = key.GetHash();
+    const size_t shardIndex = hash % ScrollingTextShardCount;
+
+    size_t scrollIndex;
+    bool found;
+    {
+        std::scoped_lock<std::mutex> lock(_scrollingTextShards[shardIndex].mutex);
+        scrollIndex = scrolling_text_get_matching_or_oldest(shardIndex, key, hash, found);
+    }
 
-    // Setup scrolling text
     auto scrollText = &_drawScrollTextList[scrollIndex];
-    scrollText->string_id = stringId;
-    std::memcpy(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args));
-    scrollText->colour = colour;
-    scrollText->position = scroll;
-    scrollText->mode = scrollingMode;
-    scrollText->id = _drawSCrollNextIndex;
+    const uint32_t imageId = SPR_SCROLLING_TEXT_START + static_cast<uint32_t>(scrollIndex);
+    if (found)
+    {
+        // Another worker may still be rendering the same text, the bitmap has to be complete before it is drawn
+        while (!scrollText->ready.load(std::memory_order_acquire))
+        {
+            std::this_thread::yield();
+        }
+        return imageId;
+    }
 
     // Create the string to draw
     utf8 scrollString[256];
-    scrolling_text_format(scrollString, 256, scrollText);
+    scrolling_text_format(scrollString, 256, key);
 
     const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
 
@@ -1489,8 +1564,8 @@ int32_t scrolling_text_setup(
     {
         scrolling_text_set_bitmap_for_sprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
     }
+    scrollText->ready.store(true, std::memory_order_release);
 
-    uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
     drawing_engine_invalidate_image(imageId);
     return imageId;
 }
@@ -43,6 +43,7 @@
 #include "../platform/platform.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
+#include "../ride/RideRatings.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -422,10 +423,22 @@ static int32_t cc_rides(InteractiveConsole& console, const arguments_t& argv)
                 }
             }
         }
+        else if (argv[0] == "rate")
+        {
+            if (network_get_mode() != NETWORK_MODE_NONE)
+            {
+                console.WriteFormatLine("This command is currently not supported in multiplayer mode.");
+            }
+            else
+            {
+                ride_ratings_recalculate_all();
+                console.WriteFormatLine("Ride ratings recalculated.");
+            }
+        }
     }
     else
     {
-        console.WriteFormatLine("subcommands: list, set");
+        console.WriteFormatLine("subcommands: list, set, rate");
     }
     return 0;
 }
@@ -1237,8 +1250,7 @@ static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused
 
 static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    map_reorganise_elements();
-    int32_t tileElementCount = gNextFreeTileElement - gTileElements - 1;
+    auto tileElementCount = map_get_num_tile_elements_in_use();
 
     int32_t rideCount = ride_get_count();
     int32_t spriteCount = 0;
@@ -1260,7 +1272,7 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     }
 
     console.WriteFormatLine("Sprites: %d/%d", spriteCount, MAX_ENTITIES);
-    console.WriteFormatLine("Map Elements: %d/%d", tileElementCount, MAX_TILE_ELEMENTS);
+    console.WriteFormatLine("Map Elements: %zu/%u", tileElementCount, MAX_TILE_ELEMENTS);
     console.WriteFormatLine("Banners: %d/%zu", bannerCount, MAX_BANNERS);
     console.WriteFormatLine("Rides: %d/%d", rideCount, MAX_RIDES);
     console.WriteFormatLine("Staff: %d/%d", staffCount, STAFF_MAX_COUNT);
@@ -29,9 +29,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -42,6 +44,9 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Number of rows of a viewport that are rendered at a time when it is written straight to a file
+constexpr int32_t ScreenshotBandHeight = 256;
+
 static bool WriteDpiToFile(std::string_view path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -378,9 +383,65 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
     viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
 }
 
+/**
+ * Renders the viewport a band of rows at a time and streams each band into the image file once it is done, so the
+ * memory used does not grow with the size of the viewport. The next band is rendered while the previous one is being
+ * compressed, which means at most two bands are held at once.
+ */
+static void WriteViewportToFile(std::string_view path, const rct_viewport& viewport, const GamePalette& palette)
+{
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
+
+    auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+    const int32_t bandHeight = std::clamp<int32_t>(viewport.height, 1, ScreenshotBandHeight);
+    const auto bandSize = static_cast<size_t>(viewport.width) * bandHeight;
+
+    std::array<std::vector<uint8_t>, 2> bandPixels;
+    std::array<rct_drawpixelinfo, 2> bands{};
+    for (size_t i = 0; i < bands.size(); i++)
+    {
+        bandPixels[i].resize(bandSize);
+        bands[i].bits = bandPixels[i].data();
+        bands[i].width = viewport.width;
+        bands[i].DrawingEngine = drawingEngine.get();
+    }
+
+    auto renderBand = [&viewport, bandHeight](rct_drawpixelinfo& dpi, int32_t top) {
+        dpi.y = top;
+        dpi.height = std::min(bandHeight, viewport.height - top);
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+        {
+            std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
+        }
+        viewport_render(&dpi, &viewport, 0, top, viewport.width, top + dpi.height);
+    };
+
+    Image image;
+    image.Width = viewport.width;
+    image.Height = viewport.height;
+    image.Depth = 8;
+    image.Stride = viewport.width;
+    image.Palette = std::make_unique<GamePalette>(palette);
+
+    size_t bandIndex = 0;
+    auto pendingBand = std::async(std::launch::async, renderBand, std::ref(bands[0]), 0);
+    Imaging::WriteToFile(path, image, bandHeight, [&](uint32_t top, uint32_t) -> const uint8_t* {
+        pendingBand.get();
+        auto& band = bands[bandIndex % bands.size()];
+        bandIndex++;
+
+        auto nextTop = static_cast<int32_t>(top) + bandHeight;
+        if (nextTop < viewport.height)
+        {
+            pendingBand = std::async(std::launch::async, renderBand, std::ref(bands[bandIndex % bands.size()]), nextTop);
+        }
+        return band.bits;
+    });
+}
+
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -409,10 +470,7 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path->c_str(), &dpi, gPalette);
+        WriteViewportToFile(*path, viewport, gPalette);
 
         // Show user that screenshot saved successfully
         Formatter ft;
@@ -425,8 +483,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -619,7 +675,6 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
     }
 
     int32_t exitCode = 1;
-    rct_drawpixelinfo dpi;
     try
     {
         core_init();
@@ -721,17 +776,13 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, &dpi, gPalette);
+        WriteViewportToFile(outputPath, viewport, gPalette);
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     drawing_engine_dispose();
 
@@ -820,10 +871,7 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, &dpi, gPalette);
-    ReleaseDPI(dpi);
+    WriteViewportToFile(outputPath, viewport, gPalette);
 
     gCurrentRotation = backupRotation;
 }
@@ -906,8 +906,13 @@ static void viewport_paint_column(paint_session* session)
     {
         PaintDrawMoneyStructs(&session->DPI, session->PSStringHead);
     }
+}
 
-    PaintSessionFree(session);
+static void viewport_fill_and_paint_column(
+    paint_session* session, std::vector<paint_session>* recorded_sessions, size_t record_index)
+{
+    viewport_fill_column(session, recorded_sessions, record_index);
+    viewport_paint_column(session);
 }
 
 /**
@@ -973,6 +978,14 @@ void viewport_paint(
         _paintJobs.reset();
     }
 
+    // Columns write to disjoint slices of the DPI, so when the drawing engine allows it each column
+    // can be generated, arranged and drawn as a single job.
+    bool useParallelDrawing = false;
+    if (useMultithreading && dpi->DrawingEngine != nullptr)
+    {
+        useParallelDrawing = (dpi->DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING) != 0;
+    }
+
     // Create space to record sessions and keep track which index is being drawn
     size_t index = 0;
     if (recorded_sessions != nullptr)
@@ -1007,7 +1020,13 @@ void viewport_paint(
         }
         dpi2.width = paintRight - dpi2.x;
 
-        if (useMultithreading)
+        if (useParallelDrawing)
+        {
+            _paintJobs->AddTask([session, recorded_sessions, index]() -> void {
+                viewport_fill_and_paint_column(session, recorded_sessions, index);
+            });
+        }
+        else if (useMultithreading)
         {
             _paintJobs->AddTask(
                 [session, recorded_sessions, index]() -> void { viewport_fill_column(session, recorded_sessions, index); });
@@ -1025,7 +1044,11 @@ void viewport_paint(
 
     for (auto column : _paintColumns)
     {
-        viewport_paint_column(column);
+        if (!useParallelDrawing)
+        {
+            viewport_paint_column(column);
+        }
+        PaintSessionFree(column);
     }
 }
 
@@ -30,13 +30,14 @@
 #include "network.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <stdexcept>
 
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "13"
+#define NETWORK_STREAM_VERSION "15"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -192,6 +193,7 @@ void NetworkBase::Close()
         CloseServerLog();
         CloseConnection();
 
+        _mapSnapshots.clear();
         client_connection_list.clear();
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
@@ -501,6 +503,8 @@ void NetworkBase::Flush()
 
 void NetworkBase::UpdateServer()
 {
+    UpdateMapSnapshots();
+
     for (auto& connection : client_connection_list)
     {
         // This can be called multiple times before the connection is removed.
@@ -714,6 +718,8 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // Every client is sent the same bytes, so the packet only has to be serialised once
+    NetworkSharedPacket sharedPacket(packet);
     for (auto& client_connection : client_connection_list)
     {
         if (client_connection->IsDisconnected)
@@ -733,8 +739,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        auto packetCopy = packet;
-        client_connection->QueuePacket(std::move(packetCopy), front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -759,11 +764,21 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (!storedTick.spriteHash.empty())
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        auto chunks = sprite_checksum_chunks();
+        rct_sprite_checksum checksum = sprite_checksum_combine_chunks(chunks);
         std::string clientSpriteHash = checksum.ToString();
         if (clientSpriteHash != storedTick.spriteHash)
         {
             log_info("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
+            for (size_t i = 0; i < std::min(chunks.size(), storedTick.spriteChunkHashes.size()); i++)
+            {
+                if (chunks[i].raw != storedTick.spriteChunkHashes[i].raw)
+                {
+                    log_info(
+                        "Sprite hash mismatch in entities %u - %u", static_cast<uint32_t>(i * SpriteChecksumChunkSize),
+                        static_cast<uint32_t>(std::min<size_t>((i + 1) * SpriteChecksumChunkSize, MAX_ENTITIES) - 1));
+                }
+            }
             return false;
         }
     }
@@ -1362,10 +1377,16 @@ void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
 
 void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
 {
-    std::vector<const ObjectRepositoryItem*> objects;
     if (connection)
     {
-        objects = connection->RequestedObjects;
+        auto* snapshot = GetMapSnapshot(connection->RequestedObjects);
+        if (snapshot == nullptr)
+        {
+            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            connection->Socket->Disconnect();
+            return;
+        }
+        QueueMapSnapshot(*connection, *snapshot);
     }
     else
     {
@@ -1373,70 +1394,162 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         // TODO: fix it so custom objects negotiation is performed even in this case.
         auto context = GetContext();
         auto& objManager = context->GetObjectManager();
-        objects = objManager.GetPackableObjects();
+        auto* snapshot = CreateMapSnapshot(objManager.GetPackableObjects());
+        if (snapshot == nullptr)
+        {
+            return;
+        }
+        for (auto& client_connection : client_connection_list)
+        {
+            if (!client_connection->IsDisconnected)
+            {
+                QueueMapSnapshot(*client_connection, *snapshot);
+            }
+        }
     }
+}
 
-    auto header = save_for_network(objects);
-    if (header.empty())
+static std::vector<const ObjectRepositoryItem*> GetSortedObjects(std::vector<const ObjectRepositoryItem*> objects)
+{
+    std::sort(objects.begin(), objects.end());
+    return objects;
+}
+
+/**
+ * Compresses a saved map and splits it into the packets sent to joining clients. Runs on a worker thread so it must
+ * not touch any game state.
+ */
+static std::vector<NetworkSharedPacket> PacketiseMapForNetwork(std::vector<uint8_t> sv6)
+{
+    const std::string_view headerString = "open2_sv6_zlib";
+    std::vector<uint8_t> header(headerString.begin(), headerString.end());
+    header.push_back('\0');
+    bool compressed = util_zlib_deflate_stream(sv6.data(), sv6.size(), [&header](const uint8_t* data, size_t size) {
+        header.insert(header.end(), data, data + size);
+    });
+    if (compressed)
     {
-        if (connection)
-        {
-            connection->SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
-            connection->Socket->Disconnect();
-        }
-        return;
+        log_verbose("Sending map of size %u bytes, compressed to %u bytes", sv6.size(), header.size());
+    }
+    else
+    {
+        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
+        header = std::move(sv6);
     }
-    size_t chunksize = CHUNK_SIZE;
-    for (size_t i = 0; i < header.size(); i += chunksize)
+
+    // Every packet carries the total size, so the map can only be split up once it is fully compressed
+    std::vector<NetworkSharedPacket> packets;
+    for (size_t i = 0; i < header.size(); i += CHUNK_SIZE)
     {
-        size_t datasize = std::min(chunksize, header.size() - i);
+        size_t datasize = std::min<size_t>(CHUNK_SIZE, header.size() - i);
         NetworkPacket packet(NetworkCommand::Map);
         packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
         packet.Write(&header[i], datasize);
-        if (connection)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
-        {
-            SendPacketToClients(packet);
-        }
+        packets.emplace_back(packet);
     }
+    return packets;
 }
 
-std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
+NetworkBase::MapSnapshot* NetworkBase::CreateMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    std::vector<uint8_t> header;
     bool RLEState = gUseRLE;
     gUseRLE = false;
 
     auto ms = OpenRCT2::MemoryStream();
-    if (!SaveMap(&ms, objects))
+    bool saved = SaveMap(&ms, objects);
+    gUseRLE = RLEState;
+    if (!saved)
     {
         log_warning("Failed to export map.");
-        return header;
+        return nullptr;
     }
-    gUseRLE = RLEState;
 
-    const void* data = ms.GetData();
-    int32_t size = ms.GetLength();
+    const auto* data = static_cast<const uint8_t*>(ms.GetData());
+    std::vector<uint8_t> sv6(data, data + ms.GetLength());
 
-    auto compressed = util_zlib_deflate(static_cast<const uint8_t*>(data), size);
-    if (compressed != std::nullopt)
+    auto snapshot = std::make_unique<MapSnapshot>();
+    snapshot->Tick = gCurrentTicks;
+    snapshot->NumGameActionsSent = _numGameActionsSent;
+    snapshot->Objects = GetSortedObjects(objects);
+    snapshot->PendingPackets = std::async(std::launch::async, PacketiseMapForNetwork, std::move(sv6));
+    _mapSnapshots.push_back(std::move(snapshot));
+    return _mapSnapshots.back().get();
+}
+
+/**
+ * Returns the newest snapshot if the park has not changed since it was taken, game state only changes on a new tick or
+ * through game actions. Otherwise a new snapshot is taken.
+ */
+NetworkBase::MapSnapshot* NetworkBase::GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects)
+{
+    if (!_mapSnapshots.empty())
     {
-        std::string headerString = "open2_sv6_zlib";
-        header.resize(headerString.size() + 1 + compressed->size());
-        std::memcpy(&header[0], headerString.c_str(), headerString.size() + 1);
-        std::memcpy(&header[headerString.size() + 1], compressed->data(), compressed->size());
-        log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, headerString.size() + 1 + compressed->size());
+        auto* snapshot = _mapSnapshots.back().get();
+        if (snapshot->Tick == gCurrentTicks && snapshot->NumGameActionsSent == _numGameActionsSent
+            && snapshot->Objects == GetSortedObjects(objects))
+        {
+            return snapshot;
+        }
+    }
+    return CreateMapSnapshot(objects);
+}
+
+void NetworkBase::QueueMapSnapshot(NetworkConnection& connection, MapSnapshot& snapshot)
+{
+    if (connection.AuthStatus != NetworkAuth::Ok)
+    {
+        return;
+    }
+
+    if (snapshot.IsReady)
+    {
+        for (const auto& packet : snapshot.Packets)
+        {
+            connection.QueuePacket(packet);
+        }
     }
     else
     {
-        log_warning("Failed to compress the data, falling back to non-compressed sv6.");
-        header.resize(size);
-        std::memcpy(header.data(), data, size);
+        // Anything sent to the client after this has to wait for the map
+        connection.QueuePlaceholder();
+        snapshot.WaitingConnections.push_back(&connection);
+    }
+}
+
+void NetworkBase::UpdateMapSnapshots()
+{
+    // Placeholders are filled in the order they were queued, so stop at the first snapshot still being compressed
+    for (auto& snapshot : _mapSnapshots)
+    {
+        if (snapshot->IsReady)
+        {
+            continue;
+        }
+        if (snapshot->PendingPackets.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            break;
+        }
+
+        snapshot->Packets = snapshot->PendingPackets.get();
+        snapshot->IsReady = true;
+        for (auto* connection : snapshot->WaitingConnections)
+        {
+            connection->FillPlaceholder(snapshot->Packets);
+        }
+        snapshot->WaitingConnections.clear();
+    }
+
+    // Only the newest snapshot can be handed out again, and only while the park has not changed
+    while (!_mapSnapshots.empty() && _mapSnapshots.front()->IsReady)
+    {
+        const auto& snapshot = _mapSnapshots.front();
+        if (_mapSnapshots.size() == 1 && snapshot->Tick == gCurrentTicks
+            && snapshot->NumGameActionsSent == _numGameActionsSent)
+        {
+            break;
+        }
+        _mapSnapshots.pop_front();
     }
-    return header;
 }
 
 void NetworkBase::Client_Send_CHAT(const char* text)
@@ -1458,12 +1571,13 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     }
     else
     {
+        NetworkSharedPacket sharedPacket(packet);
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr && !conn->IsDisconnected)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(sharedPacket);
             }
         }
     }
@@ -1500,6 +1614,7 @@ void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
     packet << gCurrentTicks << action->GetType() << stream;
 
     SendPacketToClients(packet);
+    _numGameActionsSent++;
 }
 
 void NetworkBase::Server_Send_TICK()
@@ -1522,8 +1637,16 @@ void NetworkBase::Server_Send_TICK()
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        rct_sprite_checksum checksum = sprite_checksum();
+        auto chunks = sprite_checksum_chunks();
+        rct_sprite_checksum checksum = sprite_checksum_combine_chunks(chunks);
         packet.WriteString(checksum.ToString().c_str());
+
+        // The hash of each chunk lets clients report which entities went out of sync.
+        packet << static_cast<uint16_t>(chunks.size());
+        for (const auto& chunk : chunks)
+        {
+            packet.Write(chunk.raw.data(), chunk.raw.size());
+        }
     }
 
     SendPacketToClients(packet);
@@ -1925,6 +2048,12 @@ void NetworkBase::ProcessDisconnectedClients()
             ServerClientDisconnected(connection);
             RemovePlayer(connection);
 
+            for (auto& snapshot : _mapSnapshots)
+            {
+                auto& waiting = snapshot->WaitingConnections;
+                waiting.erase(std::remove(waiting.begin(), waiting.end(), connection.get()), waiting.end());
+            }
+
             it = client_connection_list.erase(it);
         }
         else
@@ -2755,6 +2884,7 @@ bool NetworkBase::LoadMap(IStream* stream)
         gConfigGeneral.show_real_names_of_guests = stream->ReadValue<uint8_t>() != 0;
         gCheatsIgnoreResearchStatus = stream->ReadValue<uint8_t>() != 0;
         gAllowEarlyCompletionInNetworkPlay = stream->ReadValue<uint8_t>() != 0;
+        gConvergePathWideFlagsInNetworkPlay = stream->ReadValue<uint8_t>() != 0;
 
         gLastAutoSaveUpdate = AUTOSAVE_PAUSE;
         result = true;
@@ -2805,6 +2935,7 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
         stream->WriteValue<uint8_t>(gConfigGeneral.show_real_names_of_guests);
         stream->WriteValue<uint8_t>(gCheatsIgnoreResearchStatus);
         stream->WriteValue<uint8_t>(gConfigGeneral.allow_early_completion);
+        stream->WriteValue<uint8_t>(gConfigGeneral.converge_path_wide_flags);
 
         result = true;
     }
@@ -3016,6 +3147,19 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
         {
             tickData.spriteHash = text;
         }
+
+        uint16_t numChunks{};
+        packet >> numChunks;
+        for (uint16_t i = 0; i < numChunks; i++)
+        {
+            const uint8_t* data = packet.Read(sizeof(rct_sprite_checksum::raw));
+            if (data == nullptr)
+                break;
+
+            rct_sprite_checksum chunk;
+            std::memcpy(chunk.raw.data(), data, chunk.raw.size());
+            tickData.spriteChunkHashes.push_back(chunk);
+        }
     }
 
     // Don't let the history grow too much.
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../actions/GameAction.h"
+#include "../world/Sprite.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
 #include "NetworkPlayer.h"
@@ -8,7 +9,9 @@
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
+#include <deque>
 #include <fstream>
+#include <future>
 
 #ifndef DISABLE_NETWORK
 
@@ -69,7 +72,6 @@ public: // Server
     void UpdateServer();
     void ServerClientDisconnected(std::unique_ptr<NetworkConnection>& connection);
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
-    std::vector<uint8_t> save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const;
     std::string MakePlayerNameUnique(const std::string& name);
 
     // Packet dispatchers.
@@ -195,6 +197,26 @@ private: // Server Data
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
 
+    // The compressed map as sent to joining clients. Clients that join at the same tick with the same objects share
+    // the packets of one snapshot instead of saving and compressing the park again.
+    struct MapSnapshot
+    {
+        uint32_t Tick{};
+        uint32_t NumGameActionsSent{};
+        std::vector<const ObjectRepositoryItem*> Objects;
+        std::future<std::vector<NetworkSharedPacket>> PendingPackets;
+        std::vector<NetworkSharedPacket> Packets;
+        std::vector<NetworkConnection*> WaitingConnections;
+        bool IsReady{};
+    };
+    std::deque<std::unique_ptr<MapSnapshot>> _mapSnapshots;
+    uint32_t _numGameActionsSent = 0;
+
+    MapSnapshot* CreateMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects);
+    MapSnapshot* GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects);
+    void QueueMapSnapshot(NetworkConnection& connection, MapSnapshot& snapshot);
+    void UpdateMapSnapshots();
+
 private: // Client Data
     struct PlayerListUpdate
     {
@@ -206,6 +228,7 @@ private: // Client Data
         uint32_t srand0;
         uint32_t tick;
         std::string spriteHash;
+        std::vector<rct_sprite_checksum> spriteChunkHashes;
     };
 
     std::unordered_map<NetworkCommand, CommandHandler> client_command_handlers;
@@ -17,8 +17,12 @@
 #    include "Socket.h"
 #    include "network.h"
 
+#    include <algorithm>
+#    include <array>
+
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
+constexpr size_t NetworkMaxPacketsPerSend = 64;
 
 NetworkConnection::NetworkConnection()
 {
@@ -89,7 +93,7 @@ NetworkReadPacket NetworkConnection::ReadPacket()
             // Received complete packet.
             _lastPacketTime = platform_get_ticks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -98,42 +102,15 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
-    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
-    // Previously the Id field was not part of the header rather part of the body.
-    header.Size += sizeof(header.Id);
-    header.Size = Convert::HostToNetwork(header.Size);
-    header.Id = ByteSwapBE(header.Id);
-
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
-
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
-    {
-        RecordPacketStats(packet, true);
-    }
-    return sendComplete;
+    QueuePacket(NetworkSharedPacket(packet), front);
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkSharedPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -141,25 +118,88 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, { packet });
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front({ packet });
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back({ packet });
         }
     }
 }
 
+void NetworkConnection::QueuePlaceholder()
+{
+    _outboundPackets.push_back({});
+}
+
+void NetworkConnection::FillPlaceholder(const std::vector<NetworkSharedPacket>& packets)
+{
+    auto it = std::find_if(
+        _outboundPackets.begin(), _outboundPackets.end(), [](const OutboundPacket& outbound) { return !outbound.Packet.Bytes; });
+    if (it == _outboundPackets.end())
+        return;
+
+    it = _outboundPackets.erase(it);
+    for (const auto& packet : packets)
+    {
+        it = _outboundPackets.insert(it, { packet });
+        it++;
+    }
+}
+
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.pop_front();
+        // Hand as many packets as possible to the socket at once, each one straight from its shared buffer
+        std::array<SocketBuffer, NetworkMaxPacketsPerSend> buffers;
+        size_t numBuffers = 0;
+        size_t bytesToSend = 0;
+        for (; numBuffers < std::min(_outboundPackets.size(), buffers.size()); numBuffers++)
+        {
+            const auto& outbound = _outboundPackets[numBuffers];
+            if (!outbound.Packet.Bytes)
+            {
+                // Waiting for a placeholder to be filled
+                break;
+            }
+            const auto& bytes = *outbound.Packet.Bytes;
+            buffers[numBuffers] = { bytes.data() + outbound.BytesTransferred, bytes.size() - outbound.BytesTransferred };
+            bytesToSend += buffers[numBuffers].Size;
+        }
+        if (numBuffers == 0)
+        {
+            break;
+        }
+
+        size_t sent = Socket->SendData(buffers.data(), numBuffers);
+        size_t remaining = sent;
+        while (remaining > 0)
+        {
+            auto& outbound = _outboundPackets.front();
+            size_t packetSize = outbound.Packet.Bytes->size();
+            size_t packetRemaining = packetSize - outbound.BytesTransferred;
+            if (remaining < packetRemaining)
+            {
+                outbound.BytesTransferred += remaining;
+                break;
+            }
+
+            remaining -= packetRemaining;
+            RecordPacketStats(outbound.Packet.Command, packetSize, true);
+            _outboundPackets.pop_front();
+        }
+
+        if (sent < bytesToSend)
+        {
+            // Socket can not take any more for now, try again next time
+            break;
+        }
     }
 }
 
@@ -207,12 +247,12 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t size, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
+    uint32_t packetSize = static_cast<uint32_t>(size);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
@@ -41,12 +41,13 @@ public:
     ~NetworkConnection();
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const NetworkSharedPacket& packet, bool front = false);
+
+    // Reserves a place in the queue for packets that are still being prepared, nothing queued after it is sent until
+    // the placeholder is filled.
+    void QueuePlaceholder();
+    void FillPlaceholder(const std::vector<NetworkSharedPacket>& packets);
 
     void SendQueuedPackets();
     void ResetLastPacketTime();
@@ -57,12 +58,17 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    struct OutboundPacket
+    {
+        NetworkSharedPacket Packet;
+        size_t BytesTransferred{};
+    };
+
+    std::deque<OutboundPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t size, bool sending);
 };
 
 #endif // DISABLE_NETWORK
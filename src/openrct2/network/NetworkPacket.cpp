@@ -12,9 +12,28 @@
 #    include "NetworkPacket.h"
 
 #    include "NetworkTypes.h"
+#    include "Socket.h"
 
 #    include <memory>
 
+static bool CommandRequiresAuth(NetworkCommand command)
+{
+    switch (command)
+    {
+        case NetworkCommand::Ping:
+        case NetworkCommand::Auth:
+        case NetworkCommand::Token:
+        case NetworkCommand::GameInfo:
+        case NetworkCommand::ObjectsList:
+        case NetworkCommand::Scripts:
+        case NetworkCommand::MapRequest:
+        case NetworkCommand::Heartbeat:
+            return false;
+        default:
+            return true;
+    }
+}
+
 NetworkPacket::NetworkPacket(NetworkCommand id)
     : Header{ 0, id }
 {
@@ -42,22 +61,9 @@ void NetworkPacket::Clear()
     Data.clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
-    switch (GetCommand())
-    {
-        case NetworkCommand::Ping:
-        case NetworkCommand::Auth:
-        case NetworkCommand::Token:
-        case NetworkCommand::GameInfo:
-        case NetworkCommand::ObjectsList:
-        case NetworkCommand::Scripts:
-        case NetworkCommand::MapRequest:
-        case NetworkCommand::Heartbeat:
-            return false;
-        default:
-            return true;
-    }
+    return ::CommandRequiresAuth(GetCommand());
 }
 
 void NetworkPacket::Write(const void* bytes, size_t size)
@@ -102,4 +108,25 @@ const utf8* NetworkPacket::ReadString()
     return str;
 }
 
+NetworkSharedPacket::NetworkSharedPacket(const NetworkPacket& packet)
+    : Command(packet.GetCommand())
+{
+    PacketHeader header;
+    // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
+    // Previously the Id field was not part of the header rather part of the body.
+    header.Size = Convert::HostToNetwork(static_cast<uint16_t>(packet.Data.size() + sizeof(header.Id)));
+    header.Id = ByteSwapBE(packet.GetCommand());
+
+    auto bytes = std::make_shared<std::vector<uint8_t>>();
+    bytes->reserve(sizeof(header) + packet.Data.size());
+    bytes->insert(bytes->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    bytes->insert(bytes->end(), packet.Data.begin(), packet.Data.end());
+    Bytes = std::move(bytes);
+}
+
+bool NetworkSharedPacket::CommandRequiresAuth() const
+{
+    return ::CommandRequiresAuth(Command);
+}
+
 #endif
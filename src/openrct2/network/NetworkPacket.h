@@ -36,7 +36,7 @@ struct NetworkPacket final
     NetworkCommand GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
 
     const uint8_t* Read(size_t size);
     const utf8* ReadString();
@@ -79,3 +79,19 @@ public:
     size_t BytesTransferred = 0;
     size_t BytesRead = 0;
 };
+
+/**
+ * A packet in the form it is sent over the wire, header included. The bytes can not be changed once created, which
+ * lets every connection the packet is sent to share them instead of making its own copy.
+ */
+struct NetworkSharedPacket final
+{
+    NetworkSharedPacket() = default;
+    explicit NetworkSharedPacket(const NetworkPacket& packet);
+
+    bool CommandRequiresAuth() const;
+
+public:
+    NetworkCommand Command = NetworkCommand::Invalid;
+    std::shared_ptr<const std::vector<uint8_t>> Bytes;
+};
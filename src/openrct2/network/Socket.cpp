@@ -9,6 +9,7 @@
 
 #ifndef DISABLE_NETWORK
 
+#    include <algorithm>
 #    include <atomic>
 #    include <chrono>
 #    include <cmath>
@@ -51,6 +52,7 @@
     #include <netinet/tcp.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include "../common.h"
     using SOCKET = int32_t;
     #define SOCKET_ERROR -1
@@ -565,6 +567,75 @@ public:
         return totalSent;
     }
 
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
+    {
+        if (_status != SocketStatus::Connected)
+        {
+            throw std::runtime_error("Socket not connected.");
+        }
+
+        // Sends the buffers with as few calls as possible, one call can take at most this many of them
+        constexpr size_t MaxBuffersPerCall = 16;
+
+        size_t totalSent = 0;
+        size_t index = 0;
+        size_t offset = 0;
+        while (index < count)
+        {
+            size_t numBuffers = std::min(count - index, MaxBuffersPerCall);
+#    ifdef _WIN32
+            WSABUF wsaBuffers[MaxBuffersPerCall];
+            for (size_t i = 0; i < numBuffers; i++)
+            {
+                const auto& buffer = buffers[index + i];
+                size_t skip = i == 0 ? offset : 0;
+                wsaBuffers[i].buf = const_cast<char*>(static_cast<const char*>(buffer.Data) + skip);
+                wsaBuffers[i].len = static_cast<ULONG>(buffer.Size - skip);
+            }
+
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, wsaBuffers, static_cast<DWORD>(numBuffers), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    else
+            iovec ioBuffers[MaxBuffersPerCall];
+            for (size_t i = 0; i < numBuffers; i++)
+            {
+                const auto& buffer = buffers[index + i];
+                size_t skip = i == 0 ? offset : 0;
+                ioBuffers[i].iov_base = const_cast<uint8_t*>(static_cast<const uint8_t*>(buffer.Data) + skip);
+                ioBuffers[i].iov_len = buffer.Size - skip;
+            }
+
+            msghdr message{};
+            message.msg_iov = ioBuffers;
+            message.msg_iovlen = numBuffers;
+            auto sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
+            if (sentBytes == SOCKET_ERROR)
+            {
+                return totalSent;
+            }
+#    endif
+            if (sentBytes == 0)
+            {
+                return totalSent;
+            }
+            totalSent += static_cast<size_t>(sentBytes);
+
+            // Move past everything that went out
+            size_t remaining = static_cast<size_t>(sentBytes);
+            while (index < count && remaining >= buffers[index].Size - offset)
+            {
+                remaining -= buffers[index].Size - offset;
+                offset = 0;
+                index++;
+            }
+            offset += remaining;
+        }
+        return totalSent;
+    }
+
     NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) override
     {
         if (_status != SocketStatus::Connected)
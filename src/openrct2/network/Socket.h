@@ -33,6 +33,15 @@ enum class NetworkReadPacket : int32_t
     Disconnected
 };
 
+/**
+ * A block of memory that is sent as part of a scatter / gather write.
+ */
+struct SocketBuffer
+{
+    const void* Data{};
+    size_t Size{};
+};
+
 /**
  * Represents an address and port.
  */
@@ -66,6 +75,7 @@ public:
     virtual void ConnectAsync(const std::string& address, uint16_t port) abstract;
 
     virtual size_t SendData(const void* buffer, size_t size) abstract;
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NetworkReadPacket ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void SetNoDelay(bool noDelay) abstract;
@@ -14,8 +14,10 @@
 #include "../PlatformEnvironment.h"
 #include "../core/File.h"
 #include "../core/FileScanner.h"
+#include "../core/FileStream.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/ImageImporter.h"
@@ -24,12 +26,23 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+// Compiled image tables of objects, kept next to the object index so images don't need to be imported every launch.
+// Increase the version whenever importing produces different images.
+constexpr const utf8* CompiledImageTableDirectory = "objimages";
+constexpr uint32_t CompiledImageTableMagic = 0x5447494F; // OIGT
+constexpr uint16_t CompiledImageTableVersion = 1;
+constexpr int32_t CompiledImageTableNoData = -1;
+
 struct ImageTable::RequiredImage
 {
     rct_g1_element g1{};
@@ -80,6 +93,82 @@ struct ImageTable::RequiredImage
     }
 };
 
+struct LegacyImageTableCacheEntry
+{
+    std::mutex Mutex;
+    bool Loaded{};
+    std::shared_ptr<const Object> LoadedObject;
+};
+
+// Keyed by path and checksum so a DAT that is replaced on disk is decoded again
+static std::map<std::pair<std::string, uint32_t>, std::shared_ptr<LegacyImageTableCacheEntry>> _legacyImageTableCache;
+static std::mutex _legacyImageTableCacheMutex;
+static size_t _legacyImageTableCacheScopes;
+
+LegacyImageTableCacheScope::LegacyImageTableCacheScope()
+{
+    std::lock_guard<std::mutex> lock(_legacyImageTableCacheMutex);
+    _legacyImageTableCacheScopes++;
+}
+
+LegacyImageTableCacheScope::~LegacyImageTableCacheScope()
+{
+    std::lock_guard<std::mutex> lock(_legacyImageTableCacheMutex);
+    _legacyImageTableCacheScopes--;
+    if (_legacyImageTableCacheScopes == 0)
+    {
+        _legacyImageTableCache.clear();
+    }
+}
+
+static std::shared_ptr<LegacyImageTableCacheEntry> GetLegacyImageTableCacheEntry(const std::string& path)
+{
+    uint32_t checksum{};
+    try
+    {
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        checksum = fs.ReadValue<rct_object_entry>().checksum;
+    }
+    catch (const std::exception&)
+    {
+        // Let the object factory report the error
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_legacyImageTableCacheMutex);
+    if (_legacyImageTableCacheScopes == 0)
+    {
+        return nullptr;
+    }
+    auto& entry = _legacyImageTableCache[{ path, checksum }];
+    if (entry == nullptr)
+    {
+        entry = std::make_shared<LegacyImageTableCacheEntry>();
+    }
+    return entry;
+}
+
+/**
+ * Decodes the legacy object at the given path, or returns the already decoded object if a cache scope is alive.
+ */
+static std::shared_ptr<const Object> LoadLegacyObjectForImages(IObjectRepository& objectRepository, const std::string& path)
+{
+    auto entry = GetLegacyImageTableCacheEntry(path);
+    if (entry == nullptr)
+    {
+        return ObjectFactory::CreateObjectFromLegacyFile(objectRepository, path.c_str());
+    }
+
+    // Other threads wanting the same object wait here rather than decoding it again
+    std::lock_guard<std::mutex> lock(entry->Mutex);
+    if (!entry->Loaded)
+    {
+        entry->LoadedObject = ObjectFactory::CreateObjectFromLegacyFile(objectRepository, path.c_str());
+        entry->Loaded = true;
+    }
+    return entry->LoadedObject;
+}
+
 std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ParseImages(IReadObjectContext* context, std::string s)
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
@@ -190,10 +279,10 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
     auto objectPath = FindLegacyObject(name);
-    auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
+    auto obj = LoadLegacyObjectForImages(context->GetObjectRepository(), objectPath);
     if (obj != nullptr)
     {
-        auto& imgTable = static_cast<const Object*>(obj.get())->GetImageTable();
+        auto& imgTable = obj->GetImageTable();
         auto numImages = static_cast<int32_t>(imgTable.GetCount());
         auto images = imgTable.GetImages();
         size_t placeHoldersAdded = 0;
@@ -288,9 +377,179 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
     return objectPath;
 }
 
+/**
+ * Returns true if any image comes from outside the object, compiling those depends on more than the object itself.
+ */
+bool ImageTable::HasExternalImages(json_t& root)
+{
+    for (auto& jsonImage : root["images"])
+    {
+        if (jsonImage.is_string() && String::StartsWith(jsonImage.get<std::string>(), "$"))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string ImageTable::GetCompiledPath(std::string_view identifier)
+{
+    auto context = GetContext();
+    if (context == nullptr || identifier.empty())
+    {
+        return {};
+    }
+
+    std::string fileName(identifier);
+    std::replace_if(
+        fileName.begin(), fileName.end(),
+        [](char c) { return !isalnum(static_cast<uint8_t>(c)) && c != '.' && c != '-' && c != '_'; }, '_');
+    fileName += ".dat";
+
+    const auto env = context->GetPlatformEnvironment();
+    auto directory = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), CompiledImageTableDirectory);
+    return Path::Combine(directory, fileName);
+}
+
+bool ImageTable::ReadCompiled(const std::string& path, uint64_t contentHash)
+{
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    try
+    {
+        // The images point straight into the file, so only the pages of images that are drawn are ever read
+        auto file = std::make_unique<MemoryMappedFile>(path);
+        auto fileData = file->GetData();
+        auto fileLength = file->GetLength();
+        size_t position = 0;
+        auto readValue = [&](auto& value) {
+            if (position + sizeof(value) > fileLength)
+            {
+                throw std::runtime_error("Unexpected end of file");
+            }
+            std::memcpy(&value, fileData + position, sizeof(value));
+            position += sizeof(value);
+        };
+
+        uint32_t magic{};
+        uint16_t version{};
+        uint64_t hash{};
+        readValue(magic);
+        readValue(version);
+        readValue(hash);
+        if (magic != CompiledImageTableMagic || version != CompiledImageTableVersion || hash != contentHash)
+        {
+            return false;
+        }
+
+        uint32_t numImages{};
+        uint32_t dataSize{};
+        readValue(numImages);
+        readValue(dataSize);
+        if (numImages * 22ULL + dataSize > fileLength - position)
+        {
+            return false;
+        }
+
+        // All images share one block of data, the same way they do when read from a legacy object
+        auto data = fileData + position + numImages * 22ULL;
+        std::vector<rct_g1_element> newEntries(numImages);
+        for (auto& g1Element : newEntries)
+        {
+            int32_t offset{};
+            uint32_t length{};
+            readValue(offset);
+            readValue(length);
+            readValue(g1Element.width);
+            readValue(g1Element.height);
+            readValue(g1Element.x_offset);
+            readValue(g1Element.y_offset);
+            readValue(g1Element.flags);
+            readValue(g1Element.zoomed_offset);
+            if (offset != CompiledImageTableNoData)
+            {
+                if (offset < 0 || static_cast<uint64_t>(offset) + length > dataSize)
+                {
+                    return false;
+                }
+                g1Element.offset = data + offset;
+            }
+        }
+
+        _compiledFile = std::move(file);
+        _entries = std::move(newEntries);
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to read compiled image table '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+}
+
+void ImageTable::WriteCompiled(const std::string& path, uint64_t contentHash) const
+{
+    try
+    {
+        MemoryStream ms;
+        ms.WriteValue<uint32_t>(CompiledImageTableMagic);
+        ms.WriteValue<uint16_t>(CompiledImageTableVersion);
+        ms.WriteValue<uint64_t>(contentHash);
+
+        std::vector<uint32_t> lengths;
+        uint32_t dataSize = 0;
+        for (const auto& g1Element : _entries)
+        {
+            auto length = g1Element.offset != nullptr ? static_cast<uint32_t>(g1_calculate_data_size(&g1Element)) : 0;
+            lengths.push_back(length);
+            dataSize += length;
+        }
+        ms.WriteValue<uint32_t>(static_cast<uint32_t>(_entries.size()));
+        ms.WriteValue<uint32_t>(dataSize);
+
+        int32_t offset = 0;
+        for (size_t i = 0; i < _entries.size(); i++)
+        {
+            const auto& g1Element = _entries[i];
+            ms.WriteValue<int32_t>(g1Element.offset != nullptr ? offset : CompiledImageTableNoData);
+            ms.WriteValue<uint32_t>(lengths[i]);
+            ms.WriteValue<int16_t>(g1Element.width);
+            ms.WriteValue<int16_t>(g1Element.height);
+            ms.WriteValue<int16_t>(g1Element.x_offset);
+            ms.WriteValue<int16_t>(g1Element.y_offset);
+            ms.WriteValue<uint16_t>(g1Element.flags);
+            ms.WriteValue<int32_t>(g1Element.zoomed_offset);
+            offset += lengths[i];
+        }
+        for (size_t i = 0; i < _entries.size(); i++)
+        {
+            if (lengths[i] != 0)
+            {
+                ms.Write(_entries[i].offset, lengths[i]);
+            }
+        }
+
+        // Another instance may have the file mapped, truncating it in place would make reads from that mapping fault
+        auto tempPath = path + ".tmp";
+        Path::CreateDirectory(Path::GetDirectory(path));
+        File::WriteAllBytes(tempPath, ms.GetData(), ms.GetLength());
+        if (!File::Replace(tempPath, path))
+        {
+            throw IOException("Unable to move " + tempPath + " to " + path);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write compiled image table '%s': %s", path.c_str(), e.what());
+    }
+}
+
 ImageTable::~ImageTable()
 {
-    if (_data == nullptr)
+    if (_data == nullptr && _compiledFile == nullptr)
     {
         for (auto& entry : _entries)
         {
@@ -374,6 +633,18 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 
     if (context->ShouldLoadImages())
     {
+        // Reuse the images compiled by an earlier launch if the object file has not changed since
+        std::string compiledPath;
+        auto contentHash = context->GetContentHash();
+        if (contentHash != 0 && _entries.empty() && !HasExternalImages(root))
+        {
+            compiledPath = GetCompiledPath(context->GetObjectIdentifier());
+            if (!compiledPath.empty() && ReadCompiled(compiledPath, contentHash))
+            {
+                return;
+            }
+        }
+
         // First gather all the required images from inspecting the JSON
         std::vector<std::unique_ptr<RequiredImage>> allImages;
         auto jsonImages = root["images"];
@@ -429,6 +700,11 @@ void ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                 }
             }
         }
+
+        if (!compiledPath.empty())
+        {
+            WriteCompiled(compiledPath, contentHash);
+        }
     }
 }
 
@@ -11,9 +11,11 @@
 
 #include "../common.h"
 #include "../core/JsonFwd.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../drawing/Drawing.h"
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 struct IReadObjectContext;
@@ -22,10 +24,26 @@ namespace OpenRCT2
     struct IStream;
 }
 
+/**
+ * While a scope is alive, legacy objects that JSON image tables take images from are decoded only once and shared by
+ * every object referencing them. Scopes can be nested and used from several threads, the decoded objects are released
+ * when the last scope ends.
+ */
+class LegacyImageTableCacheScope
+{
+public:
+    LegacyImageTableCacheScope();
+    LegacyImageTableCacheScope(const LegacyImageTableCacheScope&) = delete;
+    LegacyImageTableCacheScope& operator=(const LegacyImageTableCacheScope&) = delete;
+    ~LegacyImageTableCacheScope();
+};
+
 class ImageTable
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
+    // Compiled image table the images point into, when they were read from one
+    std::unique_ptr<OpenRCT2::MemoryMappedFile> _compiledFile;
     std::vector<rct_g1_element> _entries;
 
     /**
@@ -41,6 +59,10 @@ private:
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
     static std::vector<int32_t> ParseRange(std::string s);
     static std::string FindLegacyObject(const std::string& name);
+    static bool HasExternalImages(json_t& root);
+    static std::string GetCompiledPath(std::string_view identifier);
+    bool ReadCompiled(const std::string& path, uint64_t contentHash);
+    void WriteCompiled(const std::string& path, uint64_t contentHash) const;
 
 public:
     ImageTable() = default;
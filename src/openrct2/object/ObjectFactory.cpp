@@ -46,6 +46,7 @@ struct IFileDataRetriever
     virtual ~IFileDataRetriever() = default;
     virtual std::vector<uint8_t> GetData(std::string_view path) const abstract;
     virtual ObjectAsset GetAsset(std::string_view path) const abstract;
+    virtual uint64_t GetContentHash() const abstract;
 };
 
 class FileSystemDataRetriever : public IFileDataRetriever
@@ -70,6 +71,12 @@ public:
         auto absolutePath = Path::Combine(_basePath, path);
         return ObjectAsset(absolutePath);
     }
+
+    uint64_t GetContentHash() const override
+    {
+        // Files of the object are spread over a directory
+        return 0;
+    }
 };
 
 class ZipDataRetriever : public IFileDataRetriever
@@ -94,6 +101,26 @@ public:
     {
         return ObjectAsset(_path, path);
     }
+
+    uint64_t GetContentHash() const override
+    {
+        // FNV-1a of the CRC32 of every file in the archive, these are stored in the central directory so the contents
+        // don't have to be read.
+        uint64_t hash = 14695981039346656037ULL;
+        auto addValue = [&hash](uint64_t value) {
+            for (int32_t i = 0; i < 8; i++)
+            {
+                hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 1099511628211ULL;
+            }
+        };
+        auto numFiles = _zipArchive.GetNumFiles();
+        addValue(numFiles);
+        for (size_t i = 0; i < numFiles; i++)
+        {
+            addValue(_zipArchive.GetFileCrc(i));
+        }
+        return hash != 0 ? hash : 1;
+    }
 };
 
 class ReadObjectContext : public IReadObjectContext
@@ -161,6 +188,15 @@ public:
         return {};
     }
 
+    uint64_t GetContentHash() override
+    {
+        if (_fileDataRetriever != nullptr)
+        {
+            return _fileDataRetriever->GetContentHash();
+        }
+        return 0;
+    }
+
     void LogWarning(ObjectError code, const utf8* text) override
     {
         _wasWarning = true;
@@ -15,7 +15,9 @@
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
 #include "../util/Util.h"
+#include "../world/TileSummary.h"
 #include "FootpathItemObject.h"
+#include "ImageTable.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
 #include "ObjectList.h"
@@ -127,6 +129,7 @@ public:
         LoadDefaultObjects();
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        map_invalidate_all_tile_summaries();
         log_verbose("%u / %u new objects loaded", numNewLoadedObjects, requiredObjects.size());
     }
 
@@ -155,6 +158,7 @@ public:
         {
             UpdateSceneryGroupIndexes();
             ResetTypeToRideEntryIndexMap();
+            map_invalidate_all_tile_summaries();
         }
     }
 
@@ -166,6 +170,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        map_invalidate_all_tile_summaries();
     }
 
     void ResetObjects() override
@@ -180,6 +185,7 @@ public:
         }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
+        map_invalidate_all_tile_summaries();
     }
 
     std::vector<const ObjectRepositoryItem*> GetPackableObjects() override
@@ -365,6 +371,7 @@ private:
                         _loadedObjects[*slot] = std::move(object);
                         UpdateSceneryGroupIndexes();
                         ResetTypeToRideEntryIndexMap();
+                        map_invalidate_all_tile_summaries();
                     }
                 }
             }
@@ -661,7 +668,8 @@ private:
         objects.resize(OBJECT_ENTRY_COUNT);
         loadedObjects.reserve(OBJECT_ENTRY_COUNT);
 
-        // Read objects
+        // Read objects, JSON objects referencing the same legacy images share the decoded objects
+        LegacyImageTableCacheScope imageTableCacheScope;
         std::mutex commonMutex;
         ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &loadedObjects](size_t i) {
             auto requiredObject = requiredObjects[i];
@@ -39,6 +39,7 @@
 #include "../world/Sprite.h"
 #include "../world/Surface.h"
 #include "../world/TileElementsView.h"
+#include "../world/TileSummary.h"
 #include "GuestPathfinding.h"
 #include "Peep.h"
 #include "Staff.h"
@@ -1856,23 +1857,10 @@ std::bitset<MAX_RIDES> Guest::FindRidesToGoOn()
     {
         // Take nearby rides into consideration
         constexpr auto radius = 10 * 32;
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - radius; tileX <= cx + radius; tileX += COORDS_XY_STEP)
-        {
-            for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
-            {
-                auto location = CoordsXY{ tileX, tileY };
-                if (!map_is_location_valid(location))
-                    continue;
-
-                for (auto* trackElement : TileElementsView<TrackElement>(location))
-                {
-                    auto rideIndex = trackElement->GetRideIndex();
-                    rideConsideration[rideIndex] = true;
-                }
-            }
-        }
+        const auto centre = CoordsXY{ floor2(x, 32), floor2(y, 32) };
+        const auto summary = map_get_tile_summary(
+            TileCoordsXY(centre - CoordsXY{ radius, radius }), TileCoordsXY(centre + CoordsXY{ radius, radius }));
+        rideConsideration |= summary.TrackRides;
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         for (auto& ride : GetRideManager())
@@ -2866,93 +2854,60 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     if ((tile_element_height({ centre_x, centre_y })) > centre_z)
         return PeepThoughtType::None;
 
-    uint16_t num_scenery = 0;
-    uint16_t num_fountains = 0;
-    uint16_t nearby_music = 0;
-    uint16_t num_rubbish = 0;
+    // 10x10 tile window, from five tiles before the centre tile to four tiles after it
+    const auto centre = CoordsXY{ centre_x, centre_y };
+    const auto lastTileOffset = 160 - COORDS_XY_STEP;
+    const auto summary = map_get_tile_summary(
+        TileCoordsXY(centre - CoordsXY{ 160, 160 }), TileCoordsXY(centre + CoordsXY{ lastTileOffset, lastTileOffset }));
+    if (summary.HasMissingAddition)
+        return PeepThoughtType::None;
 
-    int16_t initial_x = std::max(centre_x - 160, 0);
-    int16_t initial_y = std::max(centre_y - 160, 0);
-    int16_t final_x = std::min(centre_x + 160, MAXIMUM_MAP_SIZE_BIG);
-    int16_t final_y = std::min(centre_y + 160, MAXIMUM_MAP_SIZE_BIG);
+    uint16_t num_scenery = summary.NumScenery;
+    uint16_t num_fountains = summary.NumFountains;
+    uint16_t nearby_music = 0;
+    uint16_t num_rubbish = summary.NumBrokenAdditions;
 
-    for (int16_t x = initial_x; x < final_x; x += COORDS_XY_STEP)
+    for (ride_id_t rideIndex = 0; rideIndex < MAX_RIDES; rideIndex++)
     {
-        for (int16_t y = initial_y; y < final_y; y += COORDS_XY_STEP)
-        {
-            for (auto* tileElement : TileElementsView({ x, y }))
-            {
-                Ride* ride;
-                rct_scenery_entry* scenery;
-
-                switch (tileElement->GetType())
-                {
-                    case TILE_ELEMENT_TYPE_PATH:
-                        if (!tileElement->AsPath()->HasAddition())
-                            break;
+        if (!summary.TrackRides[rideIndex])
+            continue;
 
-                        scenery = tileElement->AsPath()->GetAdditionEntry();
-                        if (scenery == nullptr)
-                        {
-                            return PeepThoughtType::None;
-                        }
-                        if (tileElement->AsPath()->AdditionIsGhost())
-                            break;
+        auto ride = get_ride(rideIndex);
+        if (ride == nullptr)
+            continue;
 
-                        if (scenery->path_bit.flags
-                            & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
-                        {
-                            num_fountains++;
-                            break;
-                        }
-                        if (tileElement->AsPath()->IsBroken())
-                        {
-                            num_rubbish++;
-                        }
-                        break;
-                    case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                    case TILE_ELEMENT_TYPE_SMALL_SCENERY:
-                        num_scenery++;
-                        break;
-                    case TILE_ELEMENT_TYPE_TRACK:
-                        ride = get_ride(tileElement->AsTrack()->GetRideIndex());
-                        if (ride != nullptr)
-                        {
-                            if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RIDE_STATUS_CLOSED
-                                && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
-                            {
-                                if (ride->type == RIDE_TYPE_MERRY_GO_ROUND)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
-
-                                if (ride->music == MUSIC_STYLE_ORGAN)
-                                {
-                                    nearby_music |= 1;
-                                    break;
-                                }
-
-                                if (ride->type == RIDE_TYPE_DODGEMS)
-                                {
-                                    // Dodgems drown out music?
-                                    nearby_music |= 2;
-                                }
-                            }
-                        }
-                        break;
-                }
+        if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RIDE_STATUS_CLOSED
+            && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
+        {
+            if (ride->type == RIDE_TYPE_MERRY_GO_ROUND || ride->music == MUSIC_STYLE_ORGAN)
+            {
+                nearby_music |= 1;
+            }
+            else if (ride->type == RIDE_TYPE_DODGEMS)
+            {
+                // Dodgems drown out music?
+                nearby_music |= 2;
             }
         }
     }
 
-    for (auto litter : EntityList<Litter>())
+    const auto centreTile = TileCoordsXY(centre);
+    for (int32_t y = centreTile.y - 5; y <= centreTile.y + 5; y++)
     {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
+        for (int32_t x = centreTile.x - 5; x <= centreTile.x + 5; x++)
         {
-            num_rubbish++;
+            if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+                continue;
+
+            for (auto litter : EntityTileList<Litter>(TileCoordsXY{ x, y }.ToCoordsXY()))
+            {
+                int16_t dist_x = abs(litter->x - centre_x);
+                int16_t dist_y = abs(litter->y - centre_y);
+                if (std::max(dist_x, dist_y) <= 160)
+                {
+                    num_rubbish++;
+                }
+            }
         }
     }
 
@@ -421,20 +421,8 @@ void staff_toggle_patrol_area(int32_t staffIndex, const CoordsXY& coords)
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
-    uint16_t nearestLitterDist = 0xFFFF;
-    Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
-
-        if (distance < nearestLitterDist)
-        {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
-        }
-    }
-
-    if (nearestLitterDist > MAX_LITTER_DISTANCE)
+    auto* nearestLitter = litter_find_nearest({ x, y, z }, MAX_LITTER_DISTANCE);
+    if (nearestLitter == nullptr)
     {
         return INVALID_DIRECTION;
     }
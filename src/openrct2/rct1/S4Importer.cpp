@@ -1475,7 +1475,9 @@ private:
         // Build tile pointer cache (needed to get the first element at a certain location)
         auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(RCT1_MAX_MAP_SIZE, _s4.tile_elements);
 
-        TileElement* dstElement = gTileElements;
+        gTileElements.clear();
+        gTileElements.resize(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
+        TileElement* dstElement = gTileElements.data();
 
         for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
         {
@@ -1506,6 +1508,7 @@ private:
         }
 
         map_update_tile_pointers();
+        map_invalidate_all_path_wide_flags();
 
         FixEntrancePositions();
     }
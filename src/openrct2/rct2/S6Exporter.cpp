@@ -15,8 +15,12 @@
 #include "../OpenRCT2.h"
 #include "../common.h"
 #include "../config/Config.h"
+#include "../core/Console.hpp"
+#include "../core/Guard.hpp"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/MemoryStream.h"
 #include "../core/String.hpp"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -48,8 +52,10 @@
 #include "../world/Sprite.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <optional>
 
@@ -102,7 +108,11 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
     }
 
     // 2: Write packed objects
-    if (_s6.header.num_packed_objects > 0)
+    if (_packedObjects)
+    {
+        stream->Write(_packedObjects->data(), _packedObjects->size());
+    }
+    else if (_s6.header.num_packed_objects > 0)
     {
         auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
         objRepo.WritePackedObjects(stream, ExportObjectsList);
@@ -148,6 +158,21 @@ void S6Exporter::Save(OpenRCT2::IStream* stream, bool isScenario)
     stream->WriteValue(checksum);
 }
 
+/**
+ * Packs the objects in ExportObjectsList now, so the park can later be saved without using the object repository.
+ */
+void S6Exporter::PackObjects()
+{
+    OpenRCT2::MemoryStream ms;
+    if (!ExportObjectsList.empty())
+    {
+        auto& objRepo = OpenRCT2::GetContext()->GetObjectRepository();
+        objRepo.WritePackedObjects(&ms, ExportObjectsList);
+    }
+    auto data = static_cast<const uint8_t*>(ms.GetData());
+    _packedObjects.emplace(data, data + ms.GetLength());
+}
+
 void S6Exporter::Export()
 {
     _s6.info = gS6Info;
@@ -1571,27 +1596,52 @@ void S6Exporter::ExportMapAnimations()
 
 void S6Exporter::ExportTileElements()
 {
-    for (uint32_t index = 0; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    // The tiles are exported one after another as the storage may be larger than a saved park and contain gaps
+    uint32_t index = 0;
+    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
-        auto src = &gTileElements[index];
-        auto dst = &_s6.tile_elements[index];
-        if (src->base_height == MAX_ELEMENT_HEIGHT)
-        {
-            std::memcpy(dst, src, sizeof(*dst));
-        }
-        else
+        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
         {
-            auto tileElementType = static_cast<RCT12TileElementType>(src->GetType());
-            if (tileElementType == RCT12TileElementType::Corrupt || tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                std::memcpy(dst, src, sizeof(*dst));
-            else
-                ExportTileElement(dst, src);
+            auto src = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+            if (src == nullptr)
+                continue;
+            do
+            {
+                Guard::Assert(index < RCT2_MAX_TILE_ELEMENTS, "Too many tile elements to save");
+                if (index >= RCT2_MAX_TILE_ELEMENTS)
+                    break;
+                ExportTileElementOrCopy(&_s6.tile_elements[index++], src);
+            } while (!(src++)->IsLastForTile());
         }
     }
+
+    // Fill the rest the same way as the unused elements after compacting the map
+    TileElement unusedElement;
+    std::memset(&unusedElement, 0, sizeof(unusedElement));
+    for (; index < RCT2_MAX_TILE_ELEMENTS; index++)
+    {
+        ExportTileElementOrCopy(&_s6.tile_elements[index], &unusedElement);
+    }
     _s6.next_free_tile_element_pointer_index = gNextFreeTileElementPointerIndex;
 }
 
+void S6Exporter::ExportTileElementOrCopy(RCT12TileElement* dst, TileElement* src)
+{
+    if (src->base_height == MAX_ELEMENT_HEIGHT)
+    {
+        std::memcpy(dst, src, sizeof(*dst));
+    }
+    else
+    {
+        auto tileElementType = static_cast<RCT12TileElementType>(src->GetType());
+        if (tileElementType == RCT12TileElementType::Corrupt || tileElementType == RCT12TileElementType::EightCarsCorrupt14
+            || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
+            std::memcpy(dst, src, sizeof(*dst));
+        else
+            ExportTileElement(dst, src);
+    }
+}
+
 void S6Exporter::ExportTileElement(RCT12TileElement* dst, TileElement* src)
 {
     // Todo: allow for changing definition of OpenRCT2 tile element types - replace with a map
@@ -1827,7 +1877,10 @@ enum : uint32_t
  *  rct2: 0x006754F5
  * @param flags bit 0: pack objects, 1: save as scenario
  */
-int32_t scenario_save(const utf8* path, int32_t flags)
+/**
+ * Captures the park into a new exporter, the part of saving that has to happen on the game thread.
+ */
+static std::unique_ptr<S6Exporter> scenario_save_capture(const utf8* path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
     {
@@ -1846,38 +1899,145 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     map_reorganise_elements();
     viewport_set_saved_view();
 
+    auto s6exporter = std::make_unique<S6Exporter>();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+        s6exporter->ExportObjectsList = objManager.GetPackableObjects();
+    }
+    s6exporter->RemoveTracklessRides = true;
+    s6exporter->Export();
+    if (flags & S6_SAVE_FLAG_EXPORT)
+    {
+        // Packing objects reads from the object repository, which is not safe to do from a worker
+        s6exporter->PackObjects();
+    }
+    return s6exporter;
+}
+
+static void scenario_save_write(S6Exporter& s6exporter, const utf8* path, int32_t flags)
+{
+    if (flags & S6_SAVE_FLAG_SCENARIO)
+    {
+        s6exporter.SaveScenario(path);
+    }
+    else
+    {
+        s6exporter.SaveGame(path);
+    }
+}
+
+static void scenario_save_finish(bool result, int32_t flags)
+{
+    gfx_invalidate_screen();
+
+    if (result && !(flags & S6_SAVE_FLAG_AUTOMATIC))
+    {
+        gScreenAge = 0;
+    }
+}
+
+int32_t scenario_save(const utf8* path, int32_t flags)
+{
+    // A park still being saved in the background could otherwise be written over this one, or this one over it
+    scenario_save_async_wait();
+
     bool result = false;
-    auto s6exporter = new S6Exporter();
     try
     {
-        if (flags & S6_SAVE_FLAG_EXPORT)
-        {
-            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
-            s6exporter->ExportObjectsList = objManager.GetPackableObjects();
-        }
-        s6exporter->RemoveTracklessRides = true;
-        s6exporter->Export();
-        if (flags & S6_SAVE_FLAG_SCENARIO)
-        {
-            s6exporter->SaveScenario(path);
-        }
-        else
-        {
-            s6exporter->SaveGame(path);
-        }
+        auto s6exporter = scenario_save_capture(path, flags);
+        scenario_save_write(*s6exporter, path, flags);
         result = true;
     }
     catch (const std::exception& e)
     {
         log_error("Unable to save park: '%s'", e.what());
     }
-    delete s6exporter;
 
-    gfx_invalidate_screen();
+    scenario_save_finish(result, flags);
+    return result;
+}
 
-    if (result && !(flags & S6_SAVE_FLAG_AUTOMATIC))
+static std::future<bool> _pendingSave;
+static std::function<void(bool)> _pendingSaveCallback;
+
+/**
+ * Saves the park without holding up the game. Only the capture of the park happens straight away, encoding the chunks
+ * and writing the file is done on a worker. The file is written under a temporary name and moved over path once
+ * complete, so an interrupted save never leaves a truncated park behind. The callback is called on the game thread
+ * with the result once the file has been written, see scenario_save_async_update.
+ */
+bool scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback)
+{
+    std::unique_ptr<S6Exporter> s6exporter;
+    try
     {
-        gScreenAge = 0;
+        s6exporter = scenario_save_capture(path, flags);
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save park: '%s'", e.what());
+        scenario_save_finish(false, flags);
+        return false;
+    }
+    scenario_save_finish(true, flags);
+
+    // Saves are written one at a time, this also limits how many captured parks are held in memory
+    scenario_save_async_wait();
+    _pendingSaveCallback = std::move(callback);
+    _pendingSave = std::async(
+        std::launch::async, [s6exporter = std::move(s6exporter), path = std::string(path), flags]() {
+            auto tempPath = path + ".tmp";
+            try
+            {
+                scenario_save_write(*s6exporter, tempPath.c_str(), flags);
+                if (!File::Replace(tempPath, path))
+                {
+                    throw IOException("Unable to move " + tempPath + " to " + path);
+                }
+                log_verbose("Saved to %s", path.c_str());
+                return true;
+            }
+            catch (const std::exception& e)
+            {
+                log_error("Unable to save park: '%s'", e.what());
+                Console::Error::WriteLine("Could not save the park to '%s'.", path.c_str());
+                File::Delete(tempPath);
+                return false;
+            }
+        });
+    return true;
+}
+
+static void scenario_save_async_complete()
+{
+    auto result = _pendingSave.get();
+    auto callback = std::move(_pendingSaveCallback);
+    _pendingSaveCallback = nullptr;
+    if (callback)
+    {
+        callback(result);
+    }
+}
+
+/**
+ * Calls the callback of the park being saved in the background once it has been written.
+ */
+void scenario_save_async_update()
+{
+    if (_pendingSave.valid() && _pendingSave.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        scenario_save_async_complete();
+    }
+}
+
+/**
+ * Blocks until the park being saved in the background, if any, has been written.
+ */
+void scenario_save_async_wait()
+{
+    if (_pendingSave.valid())
+    {
+        scenario_save_async_complete();
     }
-    return result;
 }
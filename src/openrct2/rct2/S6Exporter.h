@@ -45,6 +45,7 @@ public:
     void SaveScenario(const utf8* path);
     void SaveScenario(OpenRCT2::IStream* stream);
     void Export();
+    void PackObjects();
     void ExportParkName();
     void ExportRides();
     void ExportRide(rct2_ride* dst, const Ride* src);
@@ -56,6 +57,8 @@ public:
 private:
     rct_s6_data _s6{};
     std::vector<std::string> _userStrings;
+    // Objects of ExportObjectsList packed by PackObjects, so that saving does not need the object repository
+    std::optional<std::vector<uint8_t>> _packedObjects;
 
     void Save(OpenRCT2::IStream* stream, bool isScenario);
     static uint32_t GetLoanHash(money32 initialCash, money32 bankLoan, uint32_t maxBankLoan);
@@ -74,6 +77,7 @@ private:
 
     void ExportTileElements();
     void ExportTileElement(RCT12TileElement* dst, TileElement* src);
+    void ExportTileElementOrCopy(RCT12TileElement* dst, TileElement* src);
 
     std::optional<uint16_t> AllocateUserString(std::string_view value);
     void ExportUserStrings();
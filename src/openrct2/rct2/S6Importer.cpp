@@ -451,6 +451,7 @@ public:
         // rct1_scenario_flags
         gWidePathTileLoopX = _s6.wide_path_tile_loop_x;
         gWidePathTileLoopY = _s6.wide_path_tile_loop_y;
+        map_invalidate_all_path_wide_flags();
         // pad_13CE778
 
         // Fix and set dynamic variables
@@ -1030,7 +1031,9 @@ public:
         // Build tile pointer cache (needed to get the first element at a certain location)
         auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(RCT2_MAXIMUM_MAP_SIZE_TECHNICAL, _s6.tile_elements);
 
-        TileElement* dstElement = gTileElements;
+        gTileElements.clear();
+        gTileElements.resize(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
+        TileElement* dstElement = gTileElements.data();
         for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
         {
             for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
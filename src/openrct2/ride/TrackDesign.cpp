@@ -42,6 +42,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/Paint.h"
 #include "../rct1/RCT1.h"
 #include "../rct1/Tables.h"
 #include "../util/SawyerCoding.h"
@@ -51,6 +52,7 @@
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Surface.h"
+#include "../world/TileSummary.h"
 #include "../world/Wall.h"
 #include "Ride.h"
 #include "RideData.h"
@@ -66,15 +68,22 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+// Tiles around the design that are cleared for the preview as well, large scenery and the paths joined to the entrances
+// reach past the tiles the design is measured by
+constexpr int32_t TrackDesignPreviewMargin = 4;
+
 struct map_backup
 {
-    TileElement tile_elements[MAX_TILE_ELEMENTS];
-    TileElement* tile_pointers[MAX_TILE_TILE_ELEMENT_POINTERS];
-    TileElement* next_free_tile_element;
+    TileCoordsXY tile_min;
+    TileCoordsXY tile_max;
+    std::vector<std::vector<TileElement>> tile_elements;
     uint16_t map_size_units;
     uint16_t map_size_units_minus_2;
     uint16_t map_size;
     uint8_t current_rotation;
+    uint8_t clip_height;
+    CoordsXY clip_selection_a;
+    CoordsXY clip_selection_b;
 };
 
 TrackDesign* gActiveTrackDesign;
@@ -96,11 +105,11 @@ static bool _trackDesignPlaceStateHasScenery = false;
 static bool _trackDesignPlaceStatePlaceScenery = true;
 static bool _trackDesignPlaceIsReplay = false;
 
-static std::unique_ptr<map_backup> track_design_preview_backup_map();
+static std::unique_ptr<map_backup> track_design_preview_backup_map(TrackDesign* td6);
 
 static void track_design_preview_restore_map(map_backup* backup);
 
-static void track_design_preview_clear_map();
+static void track_design_preview_clear_map(map_backup* backup);
 
 rct_string_id TrackDesign::CreateTrackDesign(const Ride& ride)
 {
@@ -1984,18 +1993,18 @@ static bool track_design_place_preview(TrackDesign* td6, money32* cost, Ride** o
  */
 void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
 {
-    // Make a copy of the map
-    auto mapBackup = track_design_preview_backup_map();
-    if (mapBackup == nullptr)
+    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
     {
-        return;
+        track_design_load_scenery_objects(td6);
     }
-    track_design_preview_clear_map();
 
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
+    // Make a copy of the part of the map the design is placed on
+    auto mapBackup = track_design_preview_backup_map(td6);
+    if (mapBackup == nullptr)
     {
-        track_design_load_scenery_objects(td6);
+        return;
     }
+    track_design_preview_clear_map(mapBackup.get());
 
     money32 cost;
     Ride* ride;
@@ -2051,7 +2060,7 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
     view.view_height = size_y;
     view.pos = { 0, 0 };
     view.zoom = zoom_level;
-    view.flags = VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_INVISIBLE_SPRITES;
+    view.flags = VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_INVISIBLE_SPRITES | VIEWPORT_FLAG_CLIP_VIEW;
 
     rct_drawpixelinfo dpi;
     dpi.zoom_level = zoom_level;
@@ -2090,22 +2099,71 @@ void track_design_draw_preview(TrackDesign* td6, uint8_t* pixels)
 }
 
 /**
- * Create a backup of the map as it will be cleared for drawing the track
+ * Gets the tiles the design covers when placed for the preview, in the same way TrackDesign::CreateTrackDesign measures
+ * a design. The map selection the outlines are drawn with is left as it was.
+ */
+static void track_design_preview_get_area(TrackDesign* td6, TileCoordsXY& tileMin, TileCoordsXY& tileMax)
+{
+    auto backupSelectionTiles = gMapSelectionTiles;
+    auto backupSelectArrowPosition = gMapSelectArrowPosition;
+    auto backupSelectArrowDirection = gMapSelectArrowDirection;
+    auto backupSelectFlags = gMapSelectFlags;
+    uint8_t backupRotation = _currentTrackPieceDirection;
+
+    _currentTrackPieceDirection = 0;
+    place_virtual_track(td6, PTD_OPERATION_DRAW_OUTLINES, true, GetOrAllocateRide(0), { 4096, 4096, 0 });
+
+    _currentTrackPieceDirection = backupRotation;
+    gMapSelectionTiles = std::move(backupSelectionTiles);
+    gMapSelectArrowPosition = backupSelectArrowPosition;
+    gMapSelectArrowDirection = backupSelectArrowDirection;
+    gMapSelectFlags = backupSelectFlags;
+
+    tileMin = { std::max(_trackPreviewMin.x / COORDS_XY_STEP - TrackDesignPreviewMargin, 0),
+                std::max(_trackPreviewMin.y / COORDS_XY_STEP - TrackDesignPreviewMargin, 0) };
+    tileMax = { std::min(_trackPreviewMax.x / COORDS_XY_STEP + TrackDesignPreviewMargin, MAXIMUM_MAP_SIZE_TECHNICAL - 1),
+                std::min(_trackPreviewMax.y / COORDS_XY_STEP + TrackDesignPreviewMargin, MAXIMUM_MAP_SIZE_TECHNICAL - 1) };
+}
+
+/**
+ * Create a backup of the part of the map that will be cleared for drawing the track
  * design preview.
  *  rct2: 0x006D1C68
  */
-static std::unique_ptr<map_backup> track_design_preview_backup_map()
+static std::unique_ptr<map_backup> track_design_preview_backup_map(TrackDesign* td6)
 {
     auto backup = std::make_unique<map_backup>();
     if (backup != nullptr)
     {
-        std::memcpy(backup->tile_elements, gTileElements, sizeof(backup->tile_elements));
-        std::memcpy(backup->tile_pointers, gTileElementTilePointers, sizeof(backup->tile_pointers));
-        backup->next_free_tile_element = gNextFreeTileElement;
         backup->map_size_units = gMapSizeUnits;
         backup->map_size_units_minus_2 = gMapSizeMinus2;
         backup->map_size = gMapSize;
         backup->current_rotation = get_current_rotation();
+        backup->clip_height = gClipHeight;
+        backup->clip_selection_a = gClipSelectionA;
+        backup->clip_selection_b = gClipSelectionB;
+
+        // The design is placed in the middle of a map of the largest size
+        gMapSizeUnits = 255 * COORDS_XY_STEP;
+        gMapSizeMinus2 = (264 * 32) - 2;
+        gMapSize = 256;
+
+        track_design_preview_get_area(td6, backup->tile_min, backup->tile_max);
+        for (int32_t y = backup->tile_min.y; y <= backup->tile_max.y; y++)
+        {
+            for (int32_t x = backup->tile_min.x; x <= backup->tile_max.x; x++)
+            {
+                auto& tileElements = backup->tile_elements.emplace_back();
+                auto* tileElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
+                if (tileElement != nullptr)
+                {
+                    do
+                    {
+                        tileElements.push_back(*tileElement);
+                    } while (!(tileElement++)->IsLastForTile());
+                }
+            }
+        }
     }
     return backup;
 }
@@ -2116,41 +2174,98 @@ static std::unique_ptr<map_backup> track_design_preview_backup_map()
  */
 static void track_design_preview_restore_map(map_backup* backup)
 {
-    std::memcpy(gTileElements, backup->tile_elements, sizeof(backup->tile_elements));
-    std::memcpy(gTileElementTilePointers, backup->tile_pointers, sizeof(backup->tile_pointers));
-    gNextFreeTileElement = backup->next_free_tile_element;
+    // Tiles that need more elements than they have now are left for a second pass, once the elements freed by the
+    // others are counted again the limit on the number of elements can't be hit
+    for (int32_t pass = 0; pass < 2; pass++)
+    {
+        size_t i = 0;
+        for (int32_t y = backup->tile_min.y; y <= backup->tile_max.y; y++)
+        {
+            for (int32_t x = backup->tile_min.x; x <= backup->tile_max.x; x++)
+            {
+                const auto& tileElements = backup->tile_elements[i++];
+                const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+                auto* tileElement = map_get_first_element_at(loc);
+                if (tileElement == nullptr || tileElements.empty())
+                {
+                    continue;
+                }
+
+                auto numElements = map_get_num_elements_on_tile(tileElement);
+                if (numElements < tileElements.size())
+                {
+                    if (pass == 0)
+                    {
+                        continue;
+                    }
+                    for (; numElements < tileElements.size(); numElements++)
+                    {
+                        if (tile_element_insert({ loc, 0 }, 0, TileElementType::Surface) == nullptr)
+                        {
+                            break;
+                        }
+                    }
+                    tileElement = map_get_first_element_at(loc);
+                }
+                else if (pass == 1)
+                {
+                    continue;
+                }
+
+                std::copy_n(tileElements.begin(), std::min(numElements, tileElements.size()), tileElement);
+                tileElement[std::min(numElements, tileElements.size()) - 1].SetLastForTile(true);
+                map_invalidate_tile_summary(loc);
+            }
+        }
+        if (pass == 0)
+        {
+            map_invalidate_tile_element_storage();
+        }
+    }
+
     gMapSizeUnits = backup->map_size_units;
     gMapSizeMinus2 = backup->map_size_units_minus_2;
     gMapSize = backup->map_size;
     gCurrentRotation = backup->current_rotation;
+    gClipHeight = backup->clip_height;
+    gClipSelectionA = backup->clip_selection_a;
+    gClipSelectionB = backup->clip_selection_b;
 }
 
 /**
- * Resets all the map elements to surface tiles for track preview.
+ * Resets the map elements around the design to surface tiles for track preview, nothing outside of them is drawn.
  *  rct2: 0x006D1D9A
  */
-static void track_design_preview_clear_map()
+static void track_design_preview_clear_map(map_backup* backup)
 {
-    // These values were previously allocated in backup map but
-    // it seems more fitting to place in this function
-    gMapSizeUnits = 255 * COORDS_XY_STEP;
-    gMapSizeMinus2 = (264 * 32) - 2;
-    gMapSize = 256;
-
-    for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
-    {
-        TileElement* tile_element = &gTileElements[i];
-        tile_element->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
-        tile_element->SetLastForTile(true);
-        tile_element->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
-        tile_element->AsSurface()->SetWaterHeight(0);
-        tile_element->AsSurface()->SetSurfaceStyle(0);
-        tile_element->AsSurface()->SetEdgeStyle(0);
-        tile_element->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
-        tile_element->AsSurface()->SetOwnership(OWNERSHIP_OWNED);
-        tile_element->AsSurface()->SetParkFences(0);
-    }
-    map_update_tile_pointers();
+    for (int32_t y = backup->tile_min.y; y <= backup->tile_max.y; y++)
+    {
+        for (int32_t x = backup->tile_min.x; x <= backup->tile_max.x; x++)
+        {
+            const auto loc = TileCoordsXY{ x, y }.ToCoordsXY();
+            TileElement* tile_element = map_get_first_element_at(loc);
+            if (tile_element == nullptr)
+            {
+                continue;
+            }
+            tile_element->ClearAs(TILE_ELEMENT_TYPE_SURFACE);
+            tile_element->SetLastForTile(true);
+            tile_element->AsSurface()->SetSlope(TILE_ELEMENT_SLOPE_FLAT);
+            tile_element->AsSurface()->SetWaterHeight(0);
+            tile_element->AsSurface()->SetSurfaceStyle(0);
+            tile_element->AsSurface()->SetEdgeStyle(0);
+            tile_element->AsSurface()->SetGrassLength(GRASS_LENGTH_CLEAR_0);
+            tile_element->AsSurface()->SetOwnership(OWNERSHIP_OWNED);
+            tile_element->AsSurface()->SetParkFences(0);
+            map_invalidate_tile_summary(loc);
+        }
+    }
+    // The elements that followed the surfaces are no longer part of their tiles
+    map_invalidate_tile_element_storage();
+
+    gClipHeight = 255;
+    gClipSelectionA = backup->tile_min.ToCoordsXY();
+    gClipSelectionB = backup->tile_max.ToCoordsXY();
 }
 
 bool track_design_are_entrance_and_exit_placed()
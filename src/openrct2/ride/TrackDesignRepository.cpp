@@ -26,6 +26,7 @@
 #include "TrackDesign.h"
 
 #include <algorithm>
+#include <list>
 #include <memory>
 #include <vector>
 
@@ -40,6 +41,17 @@ struct TrackRepositoryItem
     uint32_t Flags = 0;
 };
 
+struct TrackDesignPreviewItem
+{
+    std::string Path;
+    uint64_t LastModified = 0;
+    // Whether the scenery of the design was placed, see gTrackDesignSceneryToggle
+    bool WithScenery = false;
+    money32 Cost = 0;
+    uint8_t TrackFlags = 0;
+    std::vector<uint8_t> Pixels;
+};
+
 enum TRACK_REPO_ITEM_FLAGS
 {
     TRIF_READ_ONLY = (1 << 0),
@@ -120,6 +132,11 @@ private:
     TrackDesignFileIndex const _fileIndex;
     std::vector<TrackRepositoryItem> _items;
 
+    // Previews of the most recently selected track designs, most recent first. Drawing a preview places the design on a
+    // cleared copy of the map, so browsing back and forth through the list should not draw them again.
+    static constexpr size_t MaxPreviews = 32;
+    std::list<TrackDesignPreviewItem> _previews;
+
 public:
     explicit TrackDesignRepository(const std::shared_ptr<IPlatformEnvironment>& env)
         : _env(env)
@@ -208,6 +225,7 @@ public:
     void Scan(int32_t language) override
     {
         _items.clear();
+        _previews.clear();
         auto trackDesigns = _fileIndex.LoadOrBuild(language);
         for (const auto& td : trackDesigns)
         {
@@ -228,6 +246,7 @@ public:
             {
                 if (File::Delete(path))
                 {
+                    RemovePreview(path);
                     _items.erase(_items.begin() + index);
                     result = true;
                 }
@@ -249,6 +268,7 @@ public:
                 std::string newPath = Path::Combine(directory, newName + Path::GetExtension(path));
                 if (File::Move(path, newPath))
                 {
+                    RemovePreview(path);
                     item->Name = newName;
                     item->Path = newPath;
                     SortItems();
@@ -279,7 +299,58 @@ public:
         return result;
     }
 
+    void DrawPreview(const std::string& path, TrackDesign& td6, uint8_t* pixels) override
+    {
+        auto lastModified = File::GetLastModified(path);
+        auto withScenery = !gTrackDesignSceneryToggle;
+        auto it = FindPreview(path, withScenery);
+        if (it != _previews.end())
+        {
+            if (it->LastModified == lastModified)
+            {
+                _previews.splice(_previews.begin(), _previews, it);
+                td6.cost = it->Cost;
+                td6.track_flags = it->TrackFlags;
+                std::copy(it->Pixels.begin(), it->Pixels.end(), pixels);
+                return;
+            }
+            _previews.erase(it);
+        }
+
+        track_design_draw_preview(&td6, pixels);
+
+        auto& preview = _previews.emplace_front();
+        preview.Path = path;
+        preview.LastModified = lastModified;
+        preview.WithScenery = withScenery;
+        preview.Cost = td6.cost;
+        preview.TrackFlags = td6.track_flags;
+        preview.Pixels.assign(pixels, pixels + 4 * TRACK_PREVIEW_IMAGE_SIZE);
+        if (_previews.size() > MaxPreviews)
+        {
+            _previews.pop_back();
+        }
+    }
+
+    void ClearPreviews() override
+    {
+        _previews.clear();
+    }
+
 private:
+    std::list<TrackDesignPreviewItem>::iterator FindPreview(const std::string& path, bool withScenery)
+    {
+        return std::find_if(
+            _previews.begin(), _previews.end(), [&path, withScenery](const TrackDesignPreviewItem& preview) {
+                return preview.WithScenery == withScenery && Path::Equals(preview.Path, path);
+            });
+    }
+
+    void RemovePreview(const std::string& path)
+    {
+        _previews.remove_if([&path](const TrackDesignPreviewItem& preview) { return Path::Equals(preview.Path, path); });
+    }
+
     void SortItems()
     {
         std::sort(_items.begin(), _items.end(), [](const TrackRepositoryItem& a, const TrackRepositoryItem& b) -> bool {
@@ -22,6 +22,8 @@ struct track_design_file_ref
 #include <string>
 #include <vector>
 
+struct TrackDesign;
+
 namespace OpenRCT2
 {
     struct IPlatformEnvironment;
@@ -40,6 +42,13 @@ struct ITrackDesignRepository
     virtual bool Delete(const std::string& path) abstract;
     virtual std::string Rename(const std::string& path, const std::string& newName) abstract;
     virtual std::string Install(const std::string& path, const std::string& name) abstract;
+
+    /**
+     * Draws the preview of the track design loaded from path, reusing the last previews drawn if the file has not changed
+     * since. Also sets the cost and flags of the track design like track_design_draw_preview.
+     */
+    virtual void DrawPreview(const std::string& path, TrackDesign& td6, uint8_t* pixels) abstract;
+    virtual void ClearPreviews() abstract;
 };
 
 std::unique_ptr<ITrackDesignRepository> CreateTrackDesignRepository(const std::shared_ptr<OpenRCT2::IPlatformEnvironment>& env);
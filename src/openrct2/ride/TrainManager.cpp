@@ -17,11 +17,16 @@ namespace TrainManager
 {
     View::Iterator& View::Iterator::operator++()
     {
+        if (Entity != nullptr)
+        {
+            index = EntityListResumeIndex(*vec, index, EntityId);
+        }
         Entity = nullptr;
 
-        while (iter != end && Entity == nullptr)
+        while (index < vec->size() && Entity == nullptr)
         {
-            Entity = GetEntity<Vehicle>(*iter++);
+            EntityId = (*vec)[index++];
+            Entity = GetEntity<Vehicle>(EntityId);
             if (Entity && !Entity->IsHead())
             {
                 Entity = nullptr;
@@ -7,8 +7,9 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 #pragma once
+#include <cstddef>
 #include <cstdint>
-#include <list>
+#include <vector>
 
 struct Vehicle;
 
@@ -18,19 +19,20 @@ namespace TrainManager
     class View
     {
     private:
-        const std::list<uint16_t>* vec;
+        const std::vector<uint16_t>* vec;
 
         class Iterator
         {
         private:
-            std::list<uint16_t>::const_iterator iter;
-            std::list<uint16_t>::const_iterator end;
+            const std::vector<uint16_t>* vec;
+            std::size_t index;
             Vehicle* Entity = nullptr;
+            uint16_t EntityId = 0;
 
         public:
-            Iterator(std::list<uint16_t>::const_iterator _iter, std::list<uint16_t>::const_iterator _end)
-                : iter(_iter)
-                , end(_end)
+            Iterator(const std::vector<uint16_t>& _vec, std::size_t _index)
+                : vec(&_vec)
+                , index(_index)
             {
                 ++(*this);
             }
@@ -67,11 +69,11 @@ namespace TrainManager
 
         Iterator begin()
         {
-            return Iterator(std::cbegin(*vec), std::cend(*vec));
+            return Iterator(*vec, 0);
         }
         Iterator end()
         {
-            return Iterator(std::cend(*vec), std::cend(*vec));
+            return Iterator(*vec, vec->size());
         }
     };
 } // namespace TrainManager
@@ -25,6 +25,8 @@
 #include "../world/Map.h"
 #include "../world/MapAnimation.h"
 
+#include <functional>
+
 using random_engine_t = Random::Rct2::Engine;
 
 enum class EditorStep : uint8_t;
@@ -461,6 +463,9 @@ uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
 int32_t scenario_save(const utf8* path, int32_t flags);
+bool scenario_save_async(const utf8* path, int32_t flags, std::function<void(bool)> callback = nullptr);
+void scenario_save_async_update();
+void scenario_save_async_wait();
 void scenario_remove_trackless_rides(rct_s6_data* s6);
 void scenario_fix_ghosts(rct_s6_data* s6);
 void scenario_failure();
@@ -13,27 +13,41 @@
 
 #    include "ScriptEngine.h"
 
+#    include <chrono>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
 
+static const std::unordered_map<std::string, HOOK_TYPE> HookTypeLookupTable({
+    { "action.query", HOOK_TYPE::ACTION_QUERY },
+    { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
+    { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
+    { "interval.day", HOOK_TYPE::INTERVAL_DAY },
+    { "network.chat", HOOK_TYPE::NETWORK_CHAT },
+    { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
+    { "network.join", HOOK_TYPE::NETWORK_JOIN },
+    { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
+    { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
+    { "action.location", HOOK_TYPE::ACTION_LOCATION },
+    { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
+});
+
 HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
 {
-    static const std::unordered_map<std::string, HOOK_TYPE> LookupTable({
-        { "action.query", HOOK_TYPE::ACTION_QUERY },
-        { "action.execute", HOOK_TYPE::ACTION_EXECUTE },
-        { "interval.tick", HOOK_TYPE::INTERVAL_TICK },
-        { "interval.day", HOOK_TYPE::INTERVAL_DAY },
-        { "network.chat", HOOK_TYPE::NETWORK_CHAT },
-        { "network.authenticate", HOOK_TYPE::NETWORK_AUTHENTICATE },
-        { "network.join", HOOK_TYPE::NETWORK_JOIN },
-        { "network.leave", HOOK_TYPE::NETWORK_LEAVE },
-        { "ride.ratings.calculate", HOOK_TYPE::RIDE_RATINGS_CALCULATE },
-        { "action.location", HOOK_TYPE::ACTION_LOCATION },
-        { "guest.generation", HOOK_TYPE::GUEST_GENERATION },
-    });
-    auto result = LookupTable.find(name);
-    return (result != LookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+    auto result = HookTypeLookupTable.find(name);
+    return (result != HookTypeLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
+}
+
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    for (const auto& [name, hookType] : HookTypeLookupTable)
+    {
+        if (hookType == type)
+        {
+            return name;
+        }
+    }
+    return {};
 }
 
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
@@ -98,7 +112,7 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHook(type, hook, {}, isGameStateMutable);
     }
 }
 
@@ -107,7 +121,7 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(type, hook, { arg }, isGameStateMutable);
     }
 }
 
@@ -142,10 +156,20 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        CallHook(type, hook, dukArgs, isGameStateMutable);
     }
 }
 
+void HookEngine::CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    // The hook may unsubscribe itself while it runs
+    auto owner = hook.Owner;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    _scriptEngine.ExecutePluginCall(owner, hook.Function, args, isGameStateMutable);
+    _scriptEngine.RecordPluginTime(
+        owner, static_cast<size_t>(type), std::chrono::high_resolution_clock::now() - startTime);
+}
+
 HookList& HookEngine::GetHookList(HOOK_TYPE type)
 {
     auto index = static_cast<size_t>(type);
@@ -17,6 +17,7 @@
 #    include <any>
 #    include <memory>
 #    include <string>
+#    include <string_view>
 #    include <tuple>
 #    include <vector>
 
@@ -44,6 +45,7 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
 
     struct Hook
     {
@@ -91,6 +93,7 @@ namespace OpenRCT2::Scripting
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
     private:
+        void CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
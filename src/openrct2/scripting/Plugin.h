@@ -12,7 +12,10 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "Duktape.hpp"
+#    include "HookEngine.h"
 
+#    include <array>
+#    include <chrono>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -45,6 +48,15 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct PluginTimings
+    {
+        // Indexed by HOOK_TYPE, the last entry is for interval and timeout callbacks
+        static constexpr size_t IntervalsIndex = NUM_HOOK_TYPES;
+
+        std::array<std::chrono::duration<double>, NUM_HOOK_TYPES + 1> Time{};
+        std::array<uint64_t, NUM_HOOK_TYPES + 1> NumCalls{};
+    };
+
     class Plugin
     {
     private:
@@ -53,6 +65,7 @@ namespace OpenRCT2::Scripting
         PluginMetadata _metadata{};
         std::string _code;
         bool _hasStarted{};
+        PluginTimings _timings{};
 
     public:
         std::string GetPath() const
@@ -80,6 +93,16 @@ namespace OpenRCT2::Scripting
             return _hasStarted;
         }
 
+        const PluginTimings& GetTimings() const
+        {
+            return _timings;
+        }
+
+        PluginTimings& GetTimings()
+        {
+            return _timings;
+        }
+
         Plugin() = default;
         Plugin(duk_context* context, const std::string& path);
         Plugin(const Plugin&) = delete;
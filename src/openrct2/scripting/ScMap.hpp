@@ -153,6 +153,120 @@ namespace OpenRCT2::Scripting
             return result;
         }
 
+        /**
+         * Reads the main properties of all entities of a type at once into typed arrays, one per property, so scripts
+         * that look at every guest do not have to create an object for each of them.
+         */
+        DukValue queryEntities(const std::string& type, const DukValue& options) const
+        {
+            std::optional<MapRange> range;
+            if (options.type() == DukValue::Type::OBJECT)
+            {
+                auto dukRange = options["range"];
+                if (dukRange.type() == DukValue::Type::OBJECT)
+                {
+                    auto leftTop = dukRange["leftTop"];
+                    auto rightBottom = dukRange["rightBottom"];
+                    if (leftTop.type() == DukValue::Type::OBJECT && rightBottom.type() == DukValue::Type::OBJECT)
+                    {
+                        auto a = FromDuk<CoordsXY>(leftTop);
+                        auto b = FromDuk<CoordsXY>(rightBottom);
+                        range = MapRange(a.x, a.y, b.x, b.y).Normalise();
+                    }
+                }
+            }
+
+            EntityQueryColumns columns;
+            auto add = [&columns, &range](const SpriteBase* entity) {
+                if (range
+                    && (entity->x < range->GetLeft() || entity->x > range->GetRight() || entity->y < range->GetTop()
+                        || entity->y > range->GetBottom()))
+                    return false;
+
+                columns.Id.push_back(entity->sprite_index);
+                columns.X.push_back(entity->x);
+                columns.Y.push_back(entity->y);
+                columns.Z.push_back(entity->z);
+                return true;
+            };
+
+            bool isPeep = false;
+            if (type == "balloon")
+            {
+                for (auto sprite : EntityList<Balloon>())
+                {
+                    add(sprite);
+                }
+            }
+            else if (type == "car")
+            {
+                for (auto trainHead : TrainManager::View())
+                {
+                    for (auto carId = trainHead->sprite_index; carId != SPRITE_INDEX_NULL;)
+                    {
+                        auto car = GetEntity<Vehicle>(carId);
+                        add(car);
+                        carId = car->next_vehicle_on_train;
+                    }
+                }
+            }
+            else if (type == "litter")
+            {
+                for (auto sprite : EntityList<Litter>())
+                {
+                    add(sprite);
+                }
+            }
+            else if (type == "duck")
+            {
+                for (auto sprite : EntityList<Duck>())
+                {
+                    add(sprite);
+                }
+            }
+            else if (type == "peep")
+            {
+                isPeep = true;
+                for (auto sprite : EntityList<Guest>())
+                {
+                    if (add(sprite))
+                    {
+                        columns.AddPeep(sprite, true);
+                    }
+                }
+                for (auto sprite : EntityList<Staff>())
+                {
+                    if (add(sprite))
+                    {
+                        columns.AddPeep(sprite, false);
+                    }
+                }
+            }
+            else
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+            }
+
+            DukObject result(_context);
+            result.Set("count", static_cast<uint32_t>(columns.Id.size()));
+            result.Set("id", ToTypedArray(_context, columns.Id));
+            result.Set("x", ToTypedArray(_context, columns.X));
+            result.Set("y", ToTypedArray(_context, columns.Y));
+            result.Set("z", ToTypedArray(_context, columns.Z));
+            if (isPeep)
+            {
+                result.Set("state", ToTypedArray(_context, columns.State));
+                result.Set("energy", ToTypedArray(_context, columns.Energy));
+                result.Set("happiness", ToTypedArray(_context, columns.Happiness));
+                result.Set("nausea", ToTypedArray(_context, columns.Nausea));
+                result.Set("hunger", ToTypedArray(_context, columns.Hunger));
+                result.Set("thirst", ToTypedArray(_context, columns.Thirst));
+                result.Set("toilet", ToTypedArray(_context, columns.Toilet));
+                result.Set("cash", ToTypedArray(_context, columns.Cash));
+            }
+            return result.Take();
+        }
+
         static void Register(duk_context* ctx)
         {
             dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -163,9 +277,65 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScMap::getTile, "getTile");
             dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
             dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
+            dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
         }
 
     private:
+        struct EntityQueryColumns
+        {
+            std::vector<uint16_t> Id;
+            std::vector<int32_t> X;
+            std::vector<int32_t> Y;
+            std::vector<int32_t> Z;
+            std::vector<uint8_t> State;
+            std::vector<uint8_t> Energy;
+            std::vector<uint8_t> Happiness;
+            std::vector<uint8_t> Nausea;
+            std::vector<uint8_t> Hunger;
+            std::vector<uint8_t> Thirst;
+            std::vector<uint8_t> Toilet;
+            std::vector<int32_t> Cash;
+
+            void AddPeep(const Peep* peep, bool isGuest)
+            {
+                State.push_back(static_cast<uint8_t>(peep->State));
+                Energy.push_back(peep->Energy);
+                // Same as the ScGuest properties, which are not available on staff
+                Happiness.push_back(isGuest ? peep->Happiness : 0);
+                Nausea.push_back(isGuest ? peep->Nausea : 0);
+                Hunger.push_back(isGuest ? peep->Hunger : 0);
+                Thirst.push_back(isGuest ? peep->Thirst : 0);
+                Toilet.push_back(isGuest ? peep->Toilet : 0);
+                Cash.push_back(isGuest ? peep->CashInPocket : 0);
+            }
+        };
+
+        static constexpr duk_uint_t GetTypedArrayType(uint8_t)
+        {
+            return DUK_BUFOBJ_UINT8ARRAY;
+        }
+        static constexpr duk_uint_t GetTypedArrayType(uint16_t)
+        {
+            return DUK_BUFOBJ_UINT16ARRAY;
+        }
+        static constexpr duk_uint_t GetTypedArrayType(int32_t)
+        {
+            return DUK_BUFOBJ_INT32ARRAY;
+        }
+
+        template<typename T> static DukValue ToTypedArray(duk_context* ctx, const std::vector<T>& values)
+        {
+            auto dataLen = values.size() * sizeof(T);
+            auto data = duk_push_fixed_buffer(ctx, dataLen);
+            if (dataLen != 0)
+            {
+                std::memcpy(data, values.data(), dataLen);
+            }
+            duk_push_buffer_object(ctx, -1, 0, dataLen, GetTypedArrayType(T{}));
+            duk_remove(ctx, -2);
+            return DukValue::take_from_stack(ctx);
+        }
+
         DukValue GetEntityAsDukValue(const SpriteBase* sprite) const
         {
             auto spriteId = sprite->sprite_index;
@@ -1476,6 +1476,7 @@ namespace OpenRCT2::Scripting
         void Invalidate()
         {
             map_invalidate_tile_full(_coords);
+            map_invalidate_path_wide_flags(_coords);
         }
 
     public:
@@ -1646,6 +1647,7 @@ namespace OpenRCT2::Scripting
                 duk_size_t dataLen{};
                 auto data = duk_get_buffer_data(ctx, -1, &dataLen);
                 auto numElements = dataLen / sizeof(TileElement);
+                auto numElementsCounted = GetNumElements(GetFirstElement());
                 if (numElements == 0)
                 {
                     map_set_tile_element(TileCoordsXY(_coords), nullptr);
@@ -1661,7 +1663,10 @@ namespace OpenRCT2::Scripting
                         auto numToInsert = numElements - currentNumElements;
                         for (size_t i = 0; i < numToInsert; i++)
                         {
-                            tile_element_insert(pos, 0, TileElementType::Surface);
+                            if (tile_element_insert(pos, 0, TileElementType::Surface) != nullptr)
+                            {
+                                numElementsCounted++;
+                            }
                         }
 
                         // Copy data to element span
@@ -1681,7 +1686,13 @@ namespace OpenRCT2::Scripting
                         first[numElements - 1].SetLastForTile(true);
                     }
                 }
+                if (GetNumElements(GetFirstElement()) != numElementsCounted)
+                {
+                    // Elements were removed without going through tile_element_remove
+                    map_invalidate_tile_element_storage();
+                }
                 map_invalidate_tile_full(_coords);
+                map_invalidate_path_wide_flags(_coords);
             }
         }
 
@@ -1753,6 +1764,7 @@ namespace OpenRCT2::Scripting
             {
                 tile_element_remove(&first[index]);
                 map_invalidate_tile_full(_coords);
+                map_invalidate_path_wide_flags(_coords);
             }
         }
 
@@ -659,6 +659,7 @@ void ScriptEngine::Update()
     UpdateIntervals();
     UpdateSockets();
     ProcessREPL();
+    _scriptTimeThisUpdate = {};
 }
 
 void ScriptEngine::ProcessREPL()
@@ -743,6 +744,36 @@ void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::str
     }
 }
 
+void ScriptEngine::RecordPluginTime(
+    const std::shared_ptr<Plugin>& plugin, size_t index, std::chrono::duration<double> time)
+{
+    _scriptTimeThisUpdate += time;
+    if (plugin != nullptr)
+    {
+        auto& timings = plugin->GetTimings();
+        timings.Time[index] += time;
+        timings.NumCalls[index]++;
+    }
+}
+
+void ScriptEngine::GetPluginTimings(std::vector<ScriptTimingInfo>& timings) const
+{
+    timings.clear();
+    for (const auto& plugin : _plugins)
+    {
+        const auto& pluginTimings = plugin->GetTimings();
+        for (size_t i = 0; i < pluginTimings.NumCalls.size(); i++)
+        {
+            if (pluginTimings.NumCalls[i] == 0)
+                continue;
+
+            auto hookName = i == PluginTimings::IntervalsIndex ? "intervals" : GetHookName(static_cast<HOOK_TYPE>(i));
+            timings.push_back(
+                { plugin->GetMetadata().Name, std::string(hookName), pluginTimings.Time[i], pluginTimings.NumCalls[i] });
+        }
+    }
+}
+
 void ScriptEngine::AddNetworkPlugin(std::string_view code)
 {
     auto plugin = std::make_shared<Plugin>(_context, std::string());
@@ -1294,22 +1325,46 @@ void ScriptEngine::UpdateIntervals()
     }
     _lastIntervalTimestamp = timestamp;
 
-    for (auto& interval : _intervals)
+    // Interval callbacks can not change the game state, so once scripts have used up their time budget for this update
+    // the remaining callbacks are left for the next one. The next update carries on where this one stopped so every
+    // interval gets its turn.
+    const auto budget = std::chrono::duration<double, std::milli>(gConfigPlugin.time_budget);
+    const size_t numIntervals = _intervals.size();
+    bool ranCallback = false;
+    for (size_t i = 0; i < numIntervals; i++)
     {
-        if (interval.IsValid())
+        const size_t index = (_nextIntervalIndex + i) % numIntervals;
+        if (ranCallback && budget.count() > 0 && _scriptTimeThisUpdate >= budget)
         {
-            if (timestamp >= interval.LastTimestamp + interval.Delay)
-            {
-                ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
+            _nextIntervalIndex = index;
+            return;
+        }
+
+        // Callbacks can add and remove intervals, so the entry is looked up again afterwards
+        const auto& interval = _intervals[index];
+        if (interval.IsValid() && timestamp >= interval.LastTimestamp + interval.Delay)
+        {
+            auto owner = interval.Owner;
+            auto callback = interval.Callback;
+            auto handle = interval.Handle;
 
-                interval.LastTimestamp = timestamp;
-                if (!interval.Repeat)
+            auto startTime = std::chrono::high_resolution_clock::now();
+            ExecutePluginCall(owner, callback, {}, false);
+            RecordPluginTime(owner, PluginTimings::IntervalsIndex, std::chrono::high_resolution_clock::now() - startTime);
+            ranCallback = true;
+
+            auto& calledInterval = _intervals[index];
+            if (calledInterval.Handle == handle)
+            {
+                calledInterval.LastTimestamp = timestamp;
+                if (!calledInterval.Repeat)
                 {
-                    RemoveInterval(nullptr, interval.Handle);
+                    RemoveInterval(nullptr, handle);
                 }
             }
         }
     }
+    _nextIntervalIndex = 0;
 }
 
 void ScriptEngine::RemoveIntervals(const std::shared_ptr<Plugin>& plugin)
@@ -11,6 +11,7 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../GameState.h"
 #    include "../common.h"
 #    include "../core/FileWatcher.h"
 #    include "../management/Finance.h"
@@ -18,6 +19,7 @@
 #    include "HookEngine.h"
 #    include "Plugin.h"
 
+#    include <chrono>
 #    include <future>
 #    include <list>
 #    include <memory>
@@ -46,7 +48,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 27;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 28;
 
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
@@ -153,6 +155,8 @@ namespace OpenRCT2::Scripting
 
         uint32_t _lastIntervalTimestamp{};
         std::vector<ScriptInterval> _intervals;
+        size_t _nextIntervalIndex{};
+        std::chrono::duration<double> _scriptTimeThisUpdate{};
 
         std::unique_ptr<FileWatcher> _pluginFileWatcher;
         std::unordered_set<std::string> _changedPluginFiles;
@@ -210,6 +214,9 @@ namespace OpenRCT2::Scripting
 
         void LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::string_view message);
 
+        void RecordPluginTime(const std::shared_ptr<Plugin>& plugin, size_t index, std::chrono::duration<double> time);
+        void GetPluginTimings(std::vector<ScriptTimingInfo>& timings) const;
+
         void SubscribeToPluginStoppedEvent(std::function<void(std::shared_ptr<Plugin>)> callback)
         {
             _pluginStoppedSubscriptions.push_back(callback);
@@ -21,6 +21,8 @@
 #include <cctype>
 #include <cmath>
 #include <ctime>
+#include <limits>
+#include <memory>
 #include <random>
 
 int32_t squaredmetres_to_squaredfeet(int32_t squaredMetres)
@@ -638,6 +640,54 @@ std::optional<std::vector<uint8_t>> util_zlib_deflate(const uint8_t* data, size_
     return buffer;
 }
 
+/**
+ * @brief Deflates input using zlib, handing the compressed data to output piece by piece as it is produced
+ * @param data Data to be compressed
+ * @param data_in_size Size of data to be compressed
+ * @param output Called with each piece of compressed data, in order
+ * @return Returns false when deflate has failed, output may have already been called in that case
+ */
+bool util_zlib_deflate_stream(
+    const uint8_t* data, size_t data_in_size, const std::function<void(const uint8_t*, size_t)>& output)
+{
+    z_stream strm{};
+    if (deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK)
+    {
+        log_error("Failed to initialise stream");
+        return false;
+    }
+
+    auto out = std::make_unique<uint8_t[]>(CHUNK);
+    strm.next_in = const_cast<uint8_t*>(data);
+    size_t remaining = data_in_size;
+    int32_t ret;
+    do
+    {
+        // avail_in is only 32 bits wide, feed large inputs in parts
+        if (strm.avail_in == 0 && remaining > 0)
+        {
+            strm.avail_in = static_cast<uInt>(std::min<size_t>(remaining, std::numeric_limits<uInt>::max()));
+            remaining -= strm.avail_in;
+        }
+        strm.avail_out = CHUNK;
+        strm.next_out = out.get();
+        ret = deflate(&strm, remaining == 0 ? Z_FINISH : Z_NO_FLUSH);
+        if (ret == Z_STREAM_ERROR)
+        {
+            log_error("Your build is shipped with broken zlib. Please use the official build.");
+            deflateEnd(&strm);
+            return false;
+        }
+        size_t have = CHUNK - strm.avail_out;
+        if (have > 0)
+        {
+            output(out.get(), have);
+        }
+    } while (ret != Z_STREAM_END);
+    deflateEnd(&strm);
+    return true;
+}
+
 // Compress the source to gzip-compatible stream, write to dest.
 // Mainly used for compressing the crashdumps
 bool util_gzip_compress(FILE* source, FILE* dest)
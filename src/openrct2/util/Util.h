@@ -14,6 +14,7 @@
 
 #include <cstdio>
 #include <ctime>
+#include <functional>
 #include <optional>
 #include <type_traits>
 #include <vector>
@@ -57,6 +58,8 @@ bool str_is_null_or_empty(const char* str);
 uint32_t util_rand();
 
 std::optional<std::vector<uint8_t>> util_zlib_deflate(const uint8_t* data, size_t data_in_size);
+bool util_zlib_deflate_stream(
+    const uint8_t* data, size_t data_in_size, const std::function<void(const uint8_t*, size_t)>& output);
 uint8_t* util_zlib_inflate(uint8_t* data, size_t data_in_size, size_t* data_out_size);
 bool util_gzip_compress(FILE* source, FILE* dest);
 
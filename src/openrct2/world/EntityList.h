@@ -15,7 +15,7 @@
 #include "Location.hpp"
 #include "SpriteBase.h"
 
-#include <list>
+#include <algorithm>
 #include <vector>
 
 enum class EntityListId : uint8_t
@@ -23,7 +23,7 @@ enum class EntityListId : uint8_t
     Count = 6,
 };
 
-const std::list<uint16_t>& GetEntityList(const EntityType id);
+const std::vector<uint16_t>& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
@@ -102,27 +102,48 @@ public:
     }
 };
 
+/**
+ * Returns the position in an entity list to continue iterating from after lastId was handed out at index - 1.
+ * Entity lists are kept in sprite_index order, so if entities were added or removed in the meantime the position
+ * is found again by searching for the first entry after lastId.
+ */
+inline size_t EntityListResumeIndex(const std::vector<uint16_t>& vec, size_t index, uint16_t lastId)
+{
+    if (index > 0 && index <= vec.size() && vec[index - 1] == lastId)
+    {
+        return index;
+    }
+    return std::upper_bound(std::begin(vec), std::end(vec), lastId) - std::begin(vec);
+}
+
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<uint16_t>::const_iterator iter;
-    std::list<uint16_t>::const_iterator end;
+    const std::vector<uint16_t>* vec;
+    size_t index;
     T* Entity = nullptr;
+    uint16_t EntityId = 0;
 
 public:
-    EntityListIterator(std::list<uint16_t>::const_iterator _iter, std::list<uint16_t>::const_iterator _end)
-        : iter(_iter)
-        , end(_end)
+    EntityListIterator(const std::vector<uint16_t>& _vec, size_t _index)
+        : vec(&_vec)
+        , index(_index)
     {
         ++(*this);
     }
     EntityListIterator& operator++()
     {
+        if (Entity != nullptr)
+        {
+            // The current entity may have been removed (or others added) while iterating
+            index = EntityListResumeIndex(*vec, index, EntityId);
+        }
         Entity = nullptr;
 
-        while (iter != end && Entity == nullptr)
+        while (index < vec->size() && Entity == nullptr)
         {
-            Entity = GetEntity<T>(*iter++);
+            EntityId = (*vec)[index++];
+            Entity = GetEntity<T>(EntityId);
         }
         return *this;
     }
@@ -131,7 +152,7 @@ public:
     {
         EntityListIterator retval = *this;
         ++(*this);
-        return *iter;
+        return retval;
     }
     bool operator==(EntityListIterator other) const
     {
@@ -157,7 +178,7 @@ template<typename T = SpriteBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<uint16_t>& vec;
+    const std::vector<uint16_t>& vec;
 
 public:
     EntityList()
@@ -167,10 +188,10 @@ public:
 
     EntityListIterator_t begin()
     {
-        return EntityListIterator_t(std::cbegin(vec), std::cend(vec));
+        return EntityListIterator_t(vec, 0);
     }
     EntityListIterator_t end()
     {
-        return EntityListIterator_t(std::cend(vec), std::cend(vec));
+        return EntityListIterator_t(vec, vec.size());
     }
 };
@@ -1001,6 +1001,8 @@ void footpath_connect_edges(const CoordsXY& footpathPos, TileElement* tileElemen
     rct_neighbour_list neighbourList;
     rct_neighbour neighbour;
 
+    map_invalidate_path_wide_flags(footpathPos);
+
     footpath_update_queue_chains();
 
     neighbour_list_init(&neighbourList);
@@ -2185,6 +2187,8 @@ static void footpath_fix_corners_around(const TileCoordsXY& footpathPos, TileEle
  */
 void footpath_remove_edges_at(const CoordsXY& footpathPos, TileElement* tileElement)
 {
+    map_invalidate_path_wide_flags(footpathPos);
+
     if (tileElement->GetType() == TILE_ELEMENT_TYPE_TRACK)
     {
         auto rideIndex = tileElement->AsTrack()->GetRideIndex();
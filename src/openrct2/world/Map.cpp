@@ -54,11 +54,14 @@
 #include "Surface.h"
 #include "TileElementsView.h"
 #include "TileInspector.h"
+#include "TileSummary.h"
 #include "Wall.h"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <memory>
+#include <set>
 
 using namespace OpenRCT2;
 
@@ -92,6 +95,7 @@ uint8_t gMapGroundFlags;
 
 uint16_t gWidePathTileLoopX;
 uint16_t gWidePathTileLoopY;
+bool gConvergePathWideFlagsInNetworkPlay;
 uint16_t gGrassSceneryTileLoopPosition;
 
 int16_t gMapSizeUnits;
@@ -100,7 +104,7 @@ int16_t gMapSize;
 int16_t gMapSizeMaxXY;
 int16_t gMapBaseZ;
 
-TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+std::vector<TileElement> gTileElements;
 TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 std::vector<CoordsXY> gMapSelectionTiles;
 std::vector<PeepSpawn> gPeepSpawns;
@@ -108,6 +112,18 @@ std::vector<PeepSpawn> gPeepSpawns;
 TileElement* gNextFreeTileElement;
 uint32_t gNextFreeTileElementPointerIndex;
 
+// Free elements reserved directly after a tile's elements when the tile is moved to the end of the storage, so the
+// next few elements added to the tile can be inserted in place instead of moving the tile again.
+constexpr uint8_t TILE_ELEMENT_RESERVED_ROOM = 2;
+static std::array<uint8_t, MAX_TILE_TILE_ELEMENT_POINTERS> _tileElementReservedRoom;
+
+// Free elements made sure of at the end of the storage for every element that is about to be inserted, enough to
+// move a tile with a lot of elements and reserve room after it.
+constexpr size_t TILE_ELEMENT_ROOM_PER_INSERT = 32;
+
+// Number of elements on all tiles, excluding the free elements left behind by moving tiles
+static size_t _tileElementsInUse;
+
 bool gLandMountainMode;
 bool gLandPaintMode;
 bool gClearSmallScenery;
@@ -212,6 +228,7 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     gTileElementTilePointers[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    _tileElementReservedRoom[tilePos.x + tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL] = 0;
 }
 
 SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
@@ -256,6 +273,8 @@ void map_init(int32_t size)
 {
     gNextFreeTileElementPointerIndex = 0;
 
+    gTileElements.clear();
+    gTileElements.resize(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
     for (int32_t i = 0; i < MAX_TILE_TILE_ELEMENT_POINTERS; i++)
     {
         TileElement* tile_element = &gTileElements[i];
@@ -275,6 +294,7 @@ void map_init(int32_t size)
     gGrassSceneryTileLoopPosition = 0;
     gWidePathTileLoopX = 0;
     gWidePathTileLoopY = 0;
+    map_invalidate_all_path_wide_flags();
     gMapSizeUnits = size * 32 - 32;
     gMapSizeMinus2 = size * 32 - 2;
     gMapSize = size;
@@ -359,7 +379,7 @@ void map_update_tile_pointers()
         gTileElementTilePointers[i] = TILE_UNDEFINED_TILE_ELEMENT;
     }
 
-    TileElement* tileElement = gTileElements;
+    TileElement* tileElement = gTileElements.data();
     TileElement** tile = gTileElementTilePointers;
     for (y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
@@ -372,6 +392,41 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    _tileElementReservedRoom.fill(0);
+    _tileElementsInUse = static_cast<size_t>(tileElement - gTileElements.data());
+    map_invalidate_all_tile_summaries();
+}
+
+size_t map_get_num_tile_elements_in_use()
+{
+    return _tileElementsInUse;
+}
+
+size_t map_get_num_elements_on_tile(const TileElement* tileElement)
+{
+    if (tileElement == nullptr)
+        return 0;
+
+    size_t numElements = 1;
+    while (!(tileElement++)->IsLastForTile())
+    {
+        numElements++;
+    }
+    return numElements;
+}
+
+/**
+ * Needs to be called after the tile elements or tile pointers were replaced without going through the functions here,
+ * e.g. when restoring a copy of the map.
+ */
+void map_invalidate_tile_element_storage()
+{
+    _tileElementReservedRoom.fill(0);
+    _tileElementsInUse = 0;
+    for (auto* tileElement : gTileElementTilePointers)
+    {
+        _tileElementsInUse += map_get_num_elements_on_tile(tileElement);
+    }
 }
 
 /**
@@ -585,6 +640,134 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+// Tiles whose path wide flags need recomputing in converged mode, keyed by y * MAXIMUM_MAP_SIZE_TECHNICAL + x so
+// that they come out in the same order as the sweep below visits them.
+static std::set<uint32_t> _pathWideFlagsDirtyTiles;
+static bool _pathWideFlagsAllDirty = true;
+
+/**
+ * Returns whether path wide flags are kept converged at all times
+ * depending on the current network mode.
+ */
+static bool PathWideFlagsConverged()
+{
+    switch (network_get_mode())
+    {
+        case NETWORK_MODE_CLIENT:
+            return gConvergePathWideFlagsInNetworkPlay;
+        case NETWORK_MODE_NONE:
+        case NETWORK_MODE_SERVER:
+        default:
+            return gConfigGeneral.converge_path_wide_flags;
+    }
+}
+
+static void map_mark_path_wide_flags_dirty(const TileCoordsXY& tileLoc)
+{
+    if (tileLoc.x < 0 || tileLoc.y < 0 || tileLoc.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tileLoc.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    _pathWideFlagsDirtyTiles.insert(tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x);
+}
+
+/**
+ * Marks the path wide flags around a tile whose paths have been added, removed or modified as needing to be
+ * recomputed. Path changes can also alter the edges of neighbouring paths, which in turn are read by their own
+ * neighbours, so a radius of two tiles is marked.
+ */
+void map_invalidate_path_wide_flags(const CoordsXY& loc)
+{
+    if (_pathWideFlagsAllDirty)
+        return;
+
+    const auto tileLoc = TileCoordsXY(loc);
+    for (int32_t y = -2; y <= 2; y++)
+    {
+        for (int32_t x = -2; x <= 2; x++)
+        {
+            map_mark_path_wide_flags_dirty({ tileLoc.x + x, tileLoc.y + y });
+        }
+    }
+}
+
+void map_invalidate_all_path_wide_flags()
+{
+    _pathWideFlagsDirtyTiles.clear();
+    _pathWideFlagsAllDirty = true;
+}
+
+/**
+ * Updates the path wide flags of a tile and returns whether any of them changed.
+ */
+static bool map_update_tile_path_wide_flags(const CoordsXY& loc)
+{
+    constexpr size_t MaxTrackedElements = 64;
+    std::array<bool, MaxTrackedElements> wasWide{};
+
+    size_t numPaths = 0;
+    for (auto* pathElement : TileElementsView<PathElement>(loc))
+    {
+        if (numPaths < MaxTrackedElements)
+        {
+            wasWide[numPaths] = pathElement->IsWide();
+        }
+        numPaths++;
+    }
+    if (numPaths == 0)
+        return false;
+
+    footpath_update_path_wide_flags(loc);
+
+    if (numPaths > MaxTrackedElements)
+        return true;
+
+    size_t index = 0;
+    for (auto* pathElement : TileElementsView<PathElement>(loc))
+    {
+        if (pathElement->IsWide() != wasWide[index++])
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Brings the path wide flags to the state that the sweep converges on by only visiting dirty tiles. Tiles are
+ * processed in sweep order; when a tile's flags change the tiles that read them (all later in the order) are
+ * marked dirty so they are picked up in the same pass.
+ */
+static void map_update_path_wide_flags_converged()
+{
+    if (_pathWideFlagsAllDirty)
+    {
+        _pathWideFlagsAllDirty = false;
+        _pathWideFlagsDirtyTiles.clear();
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                footpath_update_path_wide_flags(TileCoordsXY{ x, y }.ToCoordsXY());
+            }
+        }
+        return;
+    }
+
+    while (!_pathWideFlagsDirtyTiles.empty())
+    {
+        auto it = _pathWideFlagsDirtyTiles.begin();
+        const auto tileLoc = TileCoordsXY{ static_cast<int32_t>(*it % MAXIMUM_MAP_SIZE_TECHNICAL),
+                                           static_cast<int32_t>(*it / MAXIMUM_MAP_SIZE_TECHNICAL) };
+        _pathWideFlagsDirtyTiles.erase(it);
+
+        if (map_update_tile_path_wide_flags(tileLoc.ToCoordsXY()))
+        {
+            map_mark_path_wide_flags_dirty({ tileLoc.x + 1, tileLoc.y });
+            map_mark_path_wide_flags_dirty({ tileLoc.x - 1, tileLoc.y + 1 });
+            map_mark_path_wide_flags_dirty({ tileLoc.x, tileLoc.y + 1 });
+            map_mark_path_wide_flags_dirty({ tileLoc.x + 1, tileLoc.y + 1 });
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006A876D
@@ -596,6 +779,15 @@ void map_update_path_wide_flags()
         return;
     }
 
+    if (PathWideFlagsConverged())
+    {
+        map_update_path_wide_flags_converged();
+        return;
+    }
+
+    // Dirty tiles are not tracked while sweeping, start from scratch if converged mode gets enabled.
+    map_invalidate_all_path_wide_flags();
+
     // Presumably update_path_wide_flags is too computationally expensive to call for every
     // tile every update, so gWidePathTileLoopX and gWidePathTileLoopY store the x and y
     // progress. A maximum of 128 calls is done per update.
@@ -926,6 +1118,7 @@ void tile_element_remove(TileElement* tileElement)
     // Mark the latest element with the last element flag.
     (tileElement - 1)->SetLastForTile(true);
     tileElement->base_height = MAX_ELEMENT_HEIGHT;
+    _tileElementsInUse--;
 
     if ((tileElement + 1) == gNextFreeTileElement)
     {
@@ -941,6 +1134,8 @@ void map_remove_all_rides()
 {
     tile_element_iterator it;
 
+    map_invalidate_all_tile_summaries();
+
     tile_element_iterator_begin(&it);
     do
     {
@@ -1032,21 +1227,15 @@ void map_invalidate_selection_rect()
 }
 
 /**
- *
- *  rct2: 0x0068B111
+ * Copies the elements of all tiles to the start of the storage without any gaps between the tiles. The storage is
+ * replaced by one with room for at least the given number of elements when it is smaller than that, otherwise the
+ * elements are copied back into the same storage.
  */
-void map_reorganise_elements()
+static void map_compact_tile_elements(size_t capacity)
 {
-    context_setcurrentcursor(CursorID::ZZZ);
-
-    auto newTileElements = std::make_unique<TileElement[]>(MAX_TILE_ELEMENTS_WITH_SPARE_ROOM);
-    TileElement* newElementsPtr = newTileElements.get();
-
-    if (newTileElements == nullptr)
-    {
-        log_fatal("Unable to allocate memory for map elements.");
-        return;
-    }
+    // All elements of the tiles are before the next free element
+    std::vector<TileElement> newTileElements(gNextFreeTileElement - gTileElements.data());
+    TileElement* newElementsPtr = newTileElements.data();
 
     for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
     {
@@ -1055,53 +1244,117 @@ void map_reorganise_elements()
             TileElement* startElement = map_get_first_element_at(TileCoordsXY{ x, y }.ToCoordsXY());
             if (startElement == nullptr)
                 continue;
-            TileElement* endElement = startElement;
-            while (!(endElement++)->IsLastForTile())
-                ;
 
-            const auto numElements = static_cast<uint32_t>(endElement - startElement);
+            const auto numElements = map_get_num_elements_on_tile(startElement);
             std::memcpy(newElementsPtr, startElement, numElements * sizeof(TileElement));
             newElementsPtr += numElements;
         }
     }
 
-    const auto numElements = static_cast<uint32_t>(newElementsPtr - newTileElements.get());
-    std::memcpy(gTileElements, newTileElements.get(), numElements * sizeof(TileElement));
-    std::memset(gTileElements + numElements, 0, (MAX_TILE_ELEMENTS_WITH_SPARE_ROOM - numElements) * sizeof(TileElement));
+    const auto numElements = static_cast<size_t>(newElementsPtr - newTileElements.data());
+    if (capacity > gTileElements.size())
+    {
+        gTileElements.clear();
+        gTileElements.resize(capacity);
+    }
+    std::memcpy(gTileElements.data(), newTileElements.data(), numElements * sizeof(TileElement));
+    std::memset(gTileElements.data() + numElements, 0, (gTileElements.size() - numElements) * sizeof(TileElement));
 
     map_update_tile_pointers();
 }
 
+static size_t map_get_num_free_elements_at_end()
+{
+    return gTileElements.size() - static_cast<size_t>(gNextFreeTileElement - gTileElements.data());
+}
+
+/**
+ *
+ *  rct2: 0x0068B111
+ */
+void map_reorganise_elements()
+{
+    context_setcurrentcursor(CursorID::ZZZ);
+
+    map_compact_tile_elements(0);
+}
+
+static bool map_has_room_for_elements(int32_t numElements)
+{
+    // The limit only remains because parks are saved with a fixed number of elements
+    if (numElements > 0 && _tileElementsInUse + numElements > MAX_TILE_ELEMENTS)
+    {
+        // Not enough spare elements left :'(
+        gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
+        return false;
+    }
+    return true;
+}
+
 /**
  *
  *  rct2: 0x0068B044
  *  Returns true on space available for more elements
- *  Reorganises the map elements to check for space
+ *  Grows the storage when needed so that the elements can be inserted without moving any other tiles, this
+ *  invalidates all tile element pointers so it has to be called before looking up any elements.
  */
 bool map_check_free_elements_and_reorganise(int32_t numElements)
 {
-    if (numElements != 0)
+    if (!map_has_room_for_elements(numElements))
+        return false;
+
+    const auto numFreeElementsNeeded = static_cast<size_t>(std::max(numElements, 0)) * TILE_ELEMENT_ROOM_PER_INSERT;
+    if (map_get_num_free_elements_at_end() < numFreeElementsNeeded)
     {
-        auto tileElementEnd = &gTileElements[MAX_TILE_ELEMENTS];
+        // Leave as much room as there are elements, tiles can then move this many elements before compacting again
+        map_compact_tile_elements((_tileElementsInUse + numFreeElementsNeeded) * 2);
+    }
+    return true;
+}
 
-        // Check if is there is room for the required number of elements
-        auto newTileElementEnd = gNextFreeTileElement + numElements;
-        if (newTileElementEnd > tileElementEnd)
-        {
-            // Defragment the map element list
-            map_reorganise_elements();
+static void tile_element_init(
+    TileElement* tileElement, const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type, bool isLastForTile)
+{
+    tileElement->type = 0;
+    tileElement->SetType(static_cast<uint8_t>(type));
+    tileElement->SetBaseZ(loc.z);
+    tileElement->Flags = 0;
+    tileElement->SetLastForTile(isLastForTile);
+    tileElement->SetOccupiedQuadrants(occupiedQuadrants);
+    tileElement->SetClearanceZ(loc.z);
+    tileElement->owner = 0;
+    std::memset(&tileElement->pad_05, 0, sizeof(tileElement->pad_05));
+    std::memset(&tileElement->pad_08, 0, sizeof(tileElement->pad_08));
+}
 
-            // Check if there is any room again
-            newTileElementEnd = gNextFreeTileElement + numElements;
-            if (newTileElementEnd > tileElementEnd)
-            {
-                // Not enough spare elements left :'(
-                gGameCommandErrorText = STR_ERR_LANDSCAPE_DATA_AREA_FULL;
-                return false;
-            }
+/**
+ * Inserts the element into the room reserved after the elements of the tile, moving up the elements above it.
+ */
+static TileElement* tile_element_insert_in_reserved_room(
+    TileElement* firstElement, const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
+{
+    TileElement* insertedElement = firstElement;
+    while (loc.z >= insertedElement->GetBaseZ())
+    {
+        if (insertedElement->IsLastForTile())
+        {
+            // No more elements above the insert element
+            insertedElement->SetLastForTile(false);
+            insertedElement++;
+            tile_element_init(insertedElement, loc, occupiedQuadrants, type, true);
+            return insertedElement;
         }
+        insertedElement++;
     }
-    return true;
+
+    TileElement* lastElement = insertedElement;
+    while (!lastElement->IsLastForTile())
+    {
+        lastElement++;
+    }
+    std::copy_backward(insertedElement, lastElement + 1, lastElement + 2);
+    tile_element_init(insertedElement, loc, occupiedQuadrants, type, false);
+    return insertedElement;
 }
 
 /**
@@ -1111,74 +1364,99 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
 {
     const auto& tileLoc = TileCoordsXYZ(loc);
+    const auto tileIndex = tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x;
     TileElement *originalTileElement, *newTileElement, *insertedElement;
     bool isLastForTile = false;
 
-    if (!map_check_free_elements_and_reorganise(1))
+    if (!map_has_room_for_elements(1))
     {
         log_error("Cannot insert new element");
         return nullptr;
     }
 
-    newTileElement = gNextFreeTileElement;
-    originalTileElement = gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x];
-
-    // Set tile index pointer to point to new element block
-    gTileElementTilePointers[tileLoc.y * MAXIMUM_MAP_SIZE_TECHNICAL + tileLoc.x] = newTileElement;
-
-    if (originalTileElement == nullptr)
+    if (_tileElementReservedRoom[tileIndex] > 0 && gTileElementTilePointers[tileIndex] != nullptr)
     {
-        isLastForTile = true;
+        insertedElement = tile_element_insert_in_reserved_room(
+            gTileElementTilePointers[tileIndex], loc, occupiedQuadrants, type);
+        _tileElementReservedRoom[tileIndex]--;
     }
     else
     {
-        // Copy all elements that are below the insert height
-        while (loc.z >= originalTileElement->GetBaseZ())
+        // Move the elements of the tile to the end, leaving room for the next few elements added to this tile. The
+        // storage is only compacted in place here, so pointers to elements of other tiles stay within the storage.
+        const auto numElements = map_get_num_elements_on_tile(gTileElementTilePointers[tileIndex]) + 1;
+        if (map_get_num_free_elements_at_end() < numElements + TILE_ELEMENT_RESERVED_ROOM)
+        {
+            map_compact_tile_elements(0);
+        }
+        const auto numFreeElements = map_get_num_free_elements_at_end();
+        if (numFreeElements < numElements)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
+            log_error("Cannot insert new element");
+            return nullptr;
+        }
+        const auto reservedRoom = static_cast<uint8_t>(
+            std::min<size_t>(numFreeElements - numElements, TILE_ELEMENT_RESERVED_ROOM));
+
+        newTileElement = gNextFreeTileElement;
+        originalTileElement = gTileElementTilePointers[tileIndex];
 
-            if ((newTileElement - 1)->IsLastForTile())
+        // Set tile index pointer to point to new element block
+        gTileElementTilePointers[tileIndex] = newTileElement;
+
+        if (originalTileElement == nullptr)
+        {
+            isLastForTile = true;
+        }
+        else
+        {
+            // Copy all elements that are below the insert height
+            while (loc.z >= originalTileElement->GetBaseZ())
             {
-                // No more elements above the insert element
-                (newTileElement - 1)->SetLastForTile(false);
-                isLastForTile = true;
-                break;
+                // Copy over map element
+                *newTileElement = *originalTileElement;
+                originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
+                originalTileElement++;
+                newTileElement++;
+
+                if ((newTileElement - 1)->IsLastForTile())
+                {
+                    // No more elements above the insert element
+                    (newTileElement - 1)->SetLastForTile(false);
+                    isLastForTile = true;
+                    break;
+                }
             }
         }
-    }
 
-    // Insert new map element
-    insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetType(static_cast<uint8_t>(type));
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    newTileElement->owner = 0;
-    std::memset(&newTileElement->pad_05, 0, sizeof(newTileElement->pad_05));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
-    newTileElement++;
+        // Insert new map element
+        insertedElement = newTileElement;
+        tile_element_init(newTileElement, loc, occupiedQuadrants, type, isLastForTile);
+        newTileElement++;
 
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
-    {
-        do
+        // Insert rest of map elements above insert height
+        if (!isLastForTile)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+            do
+            {
+                // Copy over map element
+                *newTileElement = *originalTileElement;
+                originalTileElement->base_height = MAX_ELEMENT_HEIGHT;
+                originalTileElement++;
+                newTileElement++;
+            } while (!((newTileElement - 1)->IsLastForTile()));
+        }
+
+        gNextFreeTileElement = newTileElement + reservedRoom;
+        _tileElementReservedRoom[tileIndex] = reservedRoom;
     }
+    _tileElementsInUse++;
 
-    gNextFreeTileElement = newTileElement;
+    map_invalidate_tile_summary(loc);
+    if (type == TileElementType::Path)
+    {
+        map_invalidate_path_wide_flags(loc);
+    }
     return insertedElement;
 }
 
@@ -1561,6 +1839,8 @@ void map_restore_provisional_elements()
  */
 void map_remove_out_of_range_elements()
 {
+    map_invalidate_all_path_wide_flags();
+
     int32_t mapMaxXY = gMapSizeMaxXY;
 
     // Ensure that we can remove elements
@@ -1773,6 +2053,8 @@ static void clear_elements_at(const CoordsXY& loc)
     if (tileElement == nullptr)
         return;
 
+    map_invalidate_tile_summary(loc);
+
     // Remove all elements except the last one
     while (!tileElement->IsLastForTile())
         clear_element_at(loc, &tileElement);
@@ -2002,6 +2284,9 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
 
 static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, int32_t maxZoom)
 {
+    // Everything that changes the contents of a tile redraws it, which makes this the place to catch those changes
+    map_invalidate_tile_summary({ x, y });
+
     if (gOpenRCT2Headless)
         return;
 
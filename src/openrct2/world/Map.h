@@ -100,6 +100,7 @@ extern const TileCoordsXY TileDirectionDelta[];
 
 extern uint16_t gWidePathTileLoopX;
 extern uint16_t gWidePathTileLoopY;
+extern bool gConvergePathWideFlagsInNetworkPlay;
 extern uint16_t gGrassSceneryTileLoopPosition;
 
 extern int16_t gMapSizeUnits;
@@ -117,7 +118,9 @@ extern uint8_t gMapSelectArrowDirection;
 
 extern uint8_t gMapGroundFlags;
 
-extern TileElement gTileElements[MAX_TILE_ELEMENTS_WITH_SPARE_ROOM];
+// Storage of all tile elements, each tile has its elements in one run. The storage holds at least
+// MAX_TILE_ELEMENTS_WITH_SPARE_ROOM elements and grows when elements are added, which moves all elements.
+extern std::vector<TileElement> gTileElements;
 extern TileElement* gTileElementTilePointers[MAX_TILE_TILE_ELEMENT_POINTERS];
 
 extern std::vector<CoordsXY> gMapSelectionTiles;
@@ -179,6 +182,9 @@ void map_init(int32_t size);
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
+void map_invalidate_tile_element_storage();
+size_t map_get_num_tile_elements_in_use();
+size_t map_get_num_elements_on_tile(const TileElement* tileElement);
 TileElement* map_get_first_element_at(const CoordsXY& elementPos);
 TileElement* map_get_nth_element_at(const CoordsXY& coords, int32_t n);
 void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements);
@@ -200,6 +206,8 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection);
 void map_remove_provisional_elements();
 void map_restore_provisional_elements();
 void map_update_path_wide_flags();
+void map_invalidate_path_wide_flags(const CoordsXY& loc);
+void map_invalidate_all_path_wide_flags();
 bool map_is_location_valid(const CoordsXY& coords);
 bool map_is_edge(const CoordsXY& coords);
 bool map_can_build_at(const CoordsXYZ& loc);
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../Game.h"
+#include "../OpenRCT2.h"
 #include "../interface/Viewport.h"
 #include "../object/StationObject.h"
 #include "../ride/Ride.h"
@@ -26,9 +27,42 @@
 #include "SmallScenery.h"
 #include "Sprite.h"
 
+#include <algorithm>
+#include <unordered_set>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
+struct MapAnimationHash
+{
+    size_t operator()(const MapAnimation& a) const
+    {
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint16_t>(a.location.x)) << 48)
+            | (static_cast<uint64_t>(static_cast<uint16_t>(a.location.y)) << 32)
+            | (static_cast<uint64_t>(static_cast<uint16_t>(a.location.z)) << 16) | a.type;
+        return std::hash<uint64_t>()(key);
+    }
+};
+
+struct MapAnimationEqual
+{
+    bool operator()(const MapAnimation& a, const MapAnimation& b) const
+    {
+        return a.type == b.type && a.location == b.location;
+    }
+};
+
+enum class MapAnimationGroup
+{
+    All,
+    AffectingGameState,
+    InvalidationOnly,
+};
+
 static std::vector<MapAnimation> _mapAnimations;
+static std::unordered_set<MapAnimation, MapAnimationHash, MapAnimationEqual> _mapAnimationIndex;
+
+// Set when animations that only redraw their tile were left alone because nothing is drawn
+static bool _mapAnimationsDeferred;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
@@ -36,25 +70,78 @@ static bool InvalidateMapAnimation(const MapAnimation& obj);
 
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
+    return _mapAnimationIndex.find({ static_cast<uint8_t>(type), location }) != _mapAnimationIndex.end();
+}
+
+/**
+ * Whether the animation does nothing but redraw its tile. Clocks make peeps check the time, on-ride photo sections
+ * count down their flash and doors store their animation frame in the wall element, which vehicles check before
+ * opening the door again, so those always have to run. Removed animations are cheap to get rid of.
+ */
+static bool MapAnimationOnlyInvalidates(uint8_t type)
+{
+    switch (type)
     {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
+        case MAP_ANIMATION_TYPE_SMALL_SCENERY:
+        case MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO:
+        case MAP_ANIMATION_TYPE_REMOVE:
+        case MAP_ANIMATION_TYPE_WALL_DOOR:
+            return false;
+        default:
             return true;
+    }
+}
+
+/**
+ * Runs the animations in the given group and removes the ones that have finished, keeping the order of the rest.
+ */
+static void UpdateMapAnimations(MapAnimationGroup group)
+{
+    auto last = std::remove_if(_mapAnimations.begin(), _mapAnimations.end(), [group](const MapAnimation& a) {
+        if (group != MapAnimationGroup::All
+            && MapAnimationOnlyInvalidates(a.type) != (group == MapAnimationGroup::InvalidationOnly))
+        {
+            return false;
         }
+        if (!InvalidateMapAnimation(a))
+        {
+            return false;
+        }
+        _mapAnimationIndex.erase(a);
+        return true;
+    });
+    _mapAnimations.erase(last, _mapAnimations.end());
+}
+
+/**
+ * Removes the finished animations that were skipped while nothing was being drawn. The skipped animations do not
+ * change any state, so this only drops the ones whose element is gone, like a client drawing them would have.
+ */
+static void UpdateDeferredMapAnimations()
+{
+    if (_mapAnimationsDeferred)
+    {
+        UpdateMapAnimations(MapAnimationGroup::InvalidationOnly);
+        _mapAnimationsDeferred = false;
     }
-    return false;
 }
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
 {
     if (!DoesAnimationExist(type, loc))
     {
+        if (_mapAnimations.size() >= MAX_ANIMATED_OBJECTS)
+        {
+            // The list may still contain animations that would have been removed if they had been drawn
+            UpdateDeferredMapAnimations();
+        }
+
         if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
         {
             // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            MapAnimation animation{ static_cast<uint8_t>(type), loc };
+            _mapAnimations.push_back(animation);
+            _mapAnimationIndex.insert(animation);
         }
         else
         {
@@ -69,18 +156,16 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
  */
 void map_animation_invalidate_all()
 {
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    if (gOpenRCT2Headless)
     {
-        if (InvalidateMapAnimation(*it))
-        {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
-        }
-        else
-        {
-            it++;
-        }
+        // Nobody will see the redraws, so animations that only redraw their tile are left until the list is needed
+        UpdateMapAnimations(MapAnimationGroup::AffectingGameState);
+        _mapAnimationsDeferred = true;
+    }
+    else
+    {
+        UpdateMapAnimations(MapAnimationGroup::All);
+        _mapAnimationsDeferred = false;
     }
 }
 
@@ -612,6 +697,8 @@ const std::vector<MapAnimation>& GetMapAnimations()
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
+    _mapAnimationIndex.clear();
+    _mapAnimationsDeferred = false;
 }
 
 void AutoCreateMapAnimations()
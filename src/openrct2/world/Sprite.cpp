@@ -13,8 +13,10 @@
 #include "../Game.h"
 #include "../OpenRCT2.h"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/Crypt.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
@@ -28,7 +30,7 @@
 #include <vector>
 
 static rct_sprite _spriteList[MAX_ENTITIES];
-static std::array<std::list<uint16_t>, EnumValue(EntityType::Count)> gEntityLists;
+static std::array<std::vector<uint16_t>, EnumValue(EntityType::Count)> gEntityLists;
 static std::vector<uint16_t> _freeIdList;
 
 static bool _spriteFlashingList[MAX_ENTITIES];
@@ -218,7 +220,7 @@ static void ResetFreeIds()
     std::iota(std::rbegin(_freeIdList), std::rend(_freeIdList), 0);
 }
 
-const std::list<uint16_t>& GetEntityList(const EntityType id)
+const std::vector<uint16_t>& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -275,37 +277,130 @@ void reset_sprite_spatial_index()
 
 #ifndef DISABLE_NETWORK
 
+template<typename T> void ComputeChecksumForEntity(Crypt::HashAlgorithm<20>* _entityHashAlg, const T* ent)
+{
+    T copy = *ent;
+
+    // Only required for rendering/invalidation, has no meaning to the game state.
+    copy.sprite_left = copy.sprite_right = copy.sprite_top = copy.sprite_bottom = 0;
+    copy.sprite_width = copy.sprite_height_negative = copy.sprite_height_positive = 0;
+
+    if constexpr (std::is_base_of_v<Peep, T>)
+    {
+        // Name is pointer and will not be the same across clients
+        copy.Name = {};
+
+        // We set this to 0 because as soon the client selects a guest the window will remove the
+        // invalidation flags causing the sprite checksum to be different than on server, the flag does not
+        // affect game state.
+        copy.WindowInvalidateFlags = 0;
+    }
+
+    _entityHashAlg->Update(&copy, sizeof(copy));
+}
+
 template<typename T> void ComputeChecksumForEntityType(Crypt::HashAlgorithm<20>* _entityHashAlg)
 {
     for (auto* ent : EntityList<T>())
     {
-        T copy = *ent;
+        ComputeChecksumForEntity(_entityHashAlg, ent);
+    }
+}
 
-        // Only required for rendering/invalidation, has no meaning to the game state.
-        copy.sprite_left = copy.sprite_right = copy.sprite_top = copy.sprite_bottom = 0;
-        copy.sprite_width = copy.sprite_height_negative = copy.sprite_height_positive = 0;
+template<typename... T> void ComputeChecksumForEntityTypes(Crypt::HashAlgorithm<20>* _entityHashAlg)
+{
+    (ComputeChecksumForEntityType<T>(_entityHashAlg), ...);
+}
 
-        if constexpr (std::is_base_of_v<Peep, T>)
-        {
-            // Name is pointer and will not be the same across clients
-            copy.Name = {};
+/**
+ * Hashes the entities with an index in [chunk * SpriteChecksumChunkSize, (chunk + 1) * SpriteChecksumChunkSize) in
+ * index order. Only the entity types that take part in the linear checksum are included.
+ */
+static rct_sprite_checksum ComputeChecksumForChunk(size_t chunk)
+{
+    auto hashAlg = Crypt::CreateSHA1();
+    const size_t firstIndex = chunk * SpriteChecksumChunkSize;
+    const size_t lastIndex = std::min<size_t>(firstIndex + SpriteChecksumChunkSize, MAX_ENTITIES);
+    for (size_t i = firstIndex; i < lastIndex; i++)
+    {
+        auto* entity = GetEntity(i);
+        if (entity == nullptr)
+            continue;
 
-            // We set this to 0 because as soon the client selects a guest the window will remove the
-            // invalidation flags causing the sprite checksum to be different than on server, the flag does not
-            // affect game state.
-            copy.WindowInvalidateFlags = 0;
+        switch (entity->Type)
+        {
+            case EntityType::Guest:
+                ComputeChecksumForEntity(hashAlg.get(), entity->As<Guest>());
+                break;
+            case EntityType::Staff:
+                ComputeChecksumForEntity(hashAlg.get(), entity->As<Staff>());
+                break;
+            case EntityType::Vehicle:
+                ComputeChecksumForEntity(hashAlg.get(), entity->As<Vehicle>());
+                break;
+            case EntityType::Litter:
+                ComputeChecksumForEntity(hashAlg.get(), entity->As<Litter>());
+                break;
+            default:
+                break;
         }
+    }
+
+    rct_sprite_checksum checksum;
+    checksum.raw = hashAlg->Finish();
+    return checksum;
+}
+
+std::vector<rct_sprite_checksum> sprite_checksum_chunks()
+{
+    // TODO Remove statics, should be one of these per sprite manager / OpenRCT2 context.
+    static std::unique_ptr<JobPool> _checksumJobs;
 
-        _entityHashAlg->Update(&copy, sizeof(copy));
+    std::vector<rct_sprite_checksum> chunks(SpriteChecksumNumChunks);
+    try
+    {
+        if (gConfigGeneral.multithreading)
+        {
+            if (_checksumJobs == nullptr)
+            {
+                _checksumJobs = std::make_unique<JobPool>();
+            }
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                _checksumJobs->AddTask([&chunks, i]() { chunks[i] = ComputeChecksumForChunk(i); });
+            }
+            _checksumJobs->Join();
+        }
+        else
+        {
+            for (size_t i = 0; i < chunks.size(); i++)
+            {
+                chunks[i] = ComputeChecksumForChunk(i);
+            }
+        }
     }
+    catch (std::exception& e)
+    {
+        log_error("sprite_checksum_chunks failed: %s", e.what());
+        throw;
+    }
+    return chunks;
 }
 
-template<typename... T> void ComputeChecksumForEntityTypes(Crypt::HashAlgorithm<20>* _entityHashAlg)
+rct_sprite_checksum sprite_checksum_combine_chunks(const std::vector<rct_sprite_checksum>& chunks)
 {
-    (ComputeChecksumForEntityType<T>(_entityHashAlg), ...);
+    auto hashAlg = Crypt::CreateSHA1();
+    for (const auto& chunk : chunks)
+    {
+        hashAlg->Update(chunk.raw.data(), chunk.raw.size());
+    }
+
+    rct_sprite_checksum checksum;
+    checksum.raw = hashAlg->Finish();
+    return checksum;
 }
 
-rct_sprite_checksum sprite_checksum()
+static rct_sprite_checksum sprite_checksum_linear()
 {
     using namespace Crypt;
 
@@ -336,9 +431,31 @@ rct_sprite_checksum sprite_checksum()
 
     return checksum;
 }
+
+rct_sprite_checksum sprite_checksum(SpriteChecksumVersion version)
+{
+    switch (version)
+    {
+        case SpriteChecksumVersion::ChunkTree:
+            return sprite_checksum_combine_chunks(sprite_checksum_chunks());
+        case SpriteChecksumVersion::Linear:
+        default:
+            return sprite_checksum_linear();
+    }
+}
 #else
 
-rct_sprite_checksum sprite_checksum()
+rct_sprite_checksum sprite_checksum(SpriteChecksumVersion)
+{
+    return rct_sprite_checksum{};
+}
+
+std::vector<rct_sprite_checksum> sprite_checksum_chunks()
+{
+    return std::vector<rct_sprite_checksum>(SpriteChecksumNumChunks);
+}
+
+rct_sprite_checksum sprite_checksum_combine_chunks(const std::vector<rct_sprite_checksum>&)
 {
     return rct_sprite_checksum{};
 }
@@ -798,6 +915,53 @@ void litter_remove_at(const CoordsXYZ& litterPos)
     }
 }
 
+/**
+ * Finds the nearest litter within maxDistance of litterPos by searching the tile spatial index in rings around the
+ * tile containing litterPos. Distance and tie breaking (lowest sprite index) match a scan of the whole litter list.
+ */
+Litter* litter_find_nearest(const CoordsXYZ& litterPos, uint16_t maxDistance)
+{
+    const auto centre = TileCoordsXY(CoordsXY{ litterPos.x, litterPos.y });
+    const int32_t maxRing = (maxDistance + COORDS_XY_STEP - 1) / COORDS_XY_STEP;
+
+    Litter* nearestLitter = nullptr;
+    uint16_t nearestLitterDist = 0xFFFF;
+    for (int32_t ring = 0; ring <= maxRing; ring++)
+    {
+        for (int32_t dy = -ring; dy <= ring; dy++)
+        {
+            // Only the outline of the square is new for each ring
+            const int32_t step = (dy == -ring || dy == ring) ? 1 : ring * 2;
+            for (int32_t dx = -ring; dx <= ring; dx += step)
+            {
+                const auto tile = TileCoordsXY{ centre.x + dx, centre.y + dy };
+                if (tile.x < 0 || tile.y < 0 || tile.x >= MAXIMUM_MAP_SIZE_TECHNICAL || tile.y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+                    continue;
+
+                for (auto litter : EntityTileList<Litter>(tile.ToCoordsXY()))
+                {
+                    uint16_t distance = abs(litter->x - litterPos.x) + abs(litter->y - litterPos.y)
+                        + abs(litter->z - litterPos.z) * 4;
+                    if (distance > maxDistance)
+                        continue;
+
+                    if (distance < nearestLitterDist
+                        || (distance == nearestLitterDist && litter->sprite_index < nearestLitter->sprite_index))
+                    {
+                        nearestLitterDist = distance;
+                        nearestLitter = litter;
+                    }
+                }
+            }
+        }
+
+        // Anything in the next ring is at least ring * COORDS_XY_STEP + 1 away
+        if (nearestLitter != nullptr && nearestLitterDist <= ring * COORDS_XY_STEP)
+            break;
+    }
+    return nearestLitter;
+}
+
 /**
  * Loops through all sprites, finds floating objects and removes them.
  * Returns the amount of removed objects as feedback.
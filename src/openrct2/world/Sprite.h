@@ -210,6 +210,7 @@ void sprite_set_coordinates(const CoordsXYZ& spritePos, SpriteBase* sprite);
 void sprite_remove(SpriteBase* sprite);
 void litter_create(const CoordsXYZD& litterPos, LitterType type);
 void litter_remove_at(const CoordsXYZ& litterPos);
+Litter* litter_find_nearest(const CoordsXYZ& litterPos, uint16_t maxDistance);
 uint16_t remove_floating_sprites();
 void sprite_misc_explosion_cloud_create(const CoordsXYZ& cloudPos);
 void sprite_misc_explosion_flare_create(const CoordsXYZ& flarePos);
@@ -233,7 +234,21 @@ void duck_remove_all();
 void crashed_vehicle_particle_create(rct_vehicle_colour colours, const CoordsXYZ& vehiclePos);
 void crash_splash_create(const CoordsXYZ& splashPos);
 
-rct_sprite_checksum sprite_checksum();
+enum class SpriteChecksumVersion : uint8_t
+{
+    // One hash over all entities, one entity type after another. Used by replays.
+    Linear,
+    // One hash per fixed range of entity indices, which are hashed again in order. The chunks are hashed in parallel
+    // and tell which range of entities differs when two checksums do not match.
+    ChunkTree,
+};
+
+constexpr size_t SpriteChecksumChunkSize = 512;
+constexpr size_t SpriteChecksumNumChunks = (MAX_ENTITIES + SpriteChecksumChunkSize - 1) / SpriteChecksumChunkSize;
+
+rct_sprite_checksum sprite_checksum(SpriteChecksumVersion version = SpriteChecksumVersion::Linear);
+std::vector<rct_sprite_checksum> sprite_checksum_chunks();
+rct_sprite_checksum sprite_checksum_combine_chunks(const std::vector<rct_sprite_checksum>& chunks);
 
 void sprite_set_flashing(SpriteBase* sprite, bool flashing);
 bool sprite_get_flashing(SpriteBase* sprite);
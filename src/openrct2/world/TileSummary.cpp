@@ -0,0 +1,258 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TileSummary.h"
+
+#include "Map.h"
+#include "Scenery.h"
+#include "TileElement.h"
+#include "TileElementsView.h"
+
+#include <algorithm>
+#include <array>
+
+using namespace OpenRCT2;
+
+// Tiles are summarised individually and in square blocks of tiles. Queries use the block sums for every block that
+// lies completely inside the range and only visit individual tiles along the edges.
+constexpr int32_t TileSummaryBlockSize = 4;
+constexpr int32_t TileSummaryNumBlocks = MAXIMUM_MAP_SIZE_TECHNICAL / TileSummaryBlockSize;
+
+// Distinct rides with track on a tile that are remembered, tiles with more are scanned again when queried.
+constexpr size_t MaxTrackRidesPerTile = 4;
+
+struct TileSummaryEntry
+{
+    uint16_t NumScenery;
+    uint16_t NumFountains;
+    uint16_t NumBrokenAdditions;
+    bool HasMissingAddition;
+    bool Dirty;
+    uint8_t NumTrackRides;
+    std::array<ride_id_t, MaxTrackRidesPerTile> TrackRides;
+};
+
+struct TileSummaryBlock
+{
+    TileSummary Summary;
+    bool Dirty;
+};
+
+static std::array<TileSummaryEntry, MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _tileSummaries;
+static std::array<TileSummaryBlock, TileSummaryNumBlocks * TileSummaryNumBlocks> _tileSummaryBlocks;
+static bool _tileSummariesAllDirty = true;
+
+static TileSummaryEntry& GetTileSummaryEntry(int32_t x, int32_t y)
+{
+    return _tileSummaries[y * MAXIMUM_MAP_SIZE_TECHNICAL + x];
+}
+
+static TileSummaryBlock& GetTileSummaryBlock(int32_t blockX, int32_t blockY)
+{
+    return _tileSummaryBlocks[blockY * TileSummaryNumBlocks + blockX];
+}
+
+static void AddTrackRide(TileSummaryEntry& entry, ride_id_t rideIndex)
+{
+    if (entry.NumTrackRides > MaxTrackRidesPerTile)
+        return;
+
+    auto end = entry.TrackRides.begin() + entry.NumTrackRides;
+    if (std::find(entry.TrackRides.begin(), end, rideIndex) != end)
+        return;
+
+    if (entry.NumTrackRides < MaxTrackRidesPerTile)
+    {
+        entry.TrackRides[entry.NumTrackRides] = rideIndex;
+    }
+    entry.NumTrackRides++;
+}
+
+static void AddTrackRideToSet(std::bitset<MAX_RIDES>& rides, ride_id_t rideIndex)
+{
+    if (rideIndex < MAX_RIDES)
+    {
+        rides[rideIndex] = true;
+    }
+}
+
+/**
+ * Counts the elements of a tile the same way peep_assess_surroundings used to when it walked the tiles itself.
+ */
+static void UpdateTileSummaryEntry(int32_t x, int32_t y)
+{
+    auto& entry = GetTileSummaryEntry(x, y);
+    entry = {};
+
+    for (auto* tileElement : TileElementsView(TileCoordsXY{ x, y }.ToCoordsXY()))
+    {
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+            {
+                auto* pathElement = tileElement->AsPath();
+                if (!pathElement->HasAddition())
+                    break;
+
+                auto* scenery = pathElement->GetAdditionEntry();
+                if (scenery == nullptr)
+                {
+                    entry.HasMissingAddition = true;
+                    break;
+                }
+                if (pathElement->AdditionIsGhost())
+                    break;
+
+                if (scenery->path_bit.flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+                {
+                    entry.NumFountains++;
+                    break;
+                }
+                if (pathElement->IsBroken())
+                {
+                    entry.NumBrokenAdditions++;
+                }
+                break;
+            }
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                entry.NumScenery++;
+                break;
+            case TILE_ELEMENT_TYPE_TRACK:
+                AddTrackRide(entry, tileElement->AsTrack()->GetRideIndex());
+                break;
+        }
+    }
+}
+
+static void AddTileSummaryEntry(TileSummary& summary, int32_t x, int32_t y)
+{
+    const auto& entry = GetTileSummaryEntry(x, y);
+    summary.NumScenery += entry.NumScenery;
+    summary.NumFountains += entry.NumFountains;
+    summary.NumBrokenAdditions += entry.NumBrokenAdditions;
+    summary.HasMissingAddition |= entry.HasMissingAddition;
+
+    if (entry.NumTrackRides <= MaxTrackRidesPerTile)
+    {
+        for (size_t i = 0; i < entry.NumTrackRides; i++)
+        {
+            AddTrackRideToSet(summary.TrackRides, entry.TrackRides[i]);
+        }
+    }
+    else
+    {
+        for (auto* trackElement : TileElementsView<TrackElement>(TileCoordsXY{ x, y }.ToCoordsXY()))
+        {
+            AddTrackRideToSet(summary.TrackRides, trackElement->GetRideIndex());
+        }
+    }
+}
+
+static void UpdateTileSummaryBlock(int32_t blockX, int32_t blockY)
+{
+    auto& block = GetTileSummaryBlock(blockX, blockY);
+    if (!block.Dirty)
+        return;
+
+    block.Summary = {};
+    for (int32_t y = blockY * TileSummaryBlockSize; y < (blockY + 1) * TileSummaryBlockSize; y++)
+    {
+        for (int32_t x = blockX * TileSummaryBlockSize; x < (blockX + 1) * TileSummaryBlockSize; x++)
+        {
+            auto& entry = GetTileSummaryEntry(x, y);
+            if (entry.Dirty)
+            {
+                UpdateTileSummaryEntry(x, y);
+            }
+            AddTileSummaryEntry(block.Summary, x, y);
+        }
+    }
+    block.Dirty = false;
+}
+
+static void MarkAllTileSummariesDirty()
+{
+    for (auto& entry : _tileSummaries)
+    {
+        entry.Dirty = true;
+    }
+    for (auto& block : _tileSummaryBlocks)
+    {
+        block.Dirty = true;
+    }
+    _tileSummariesAllDirty = false;
+}
+
+TileSummary map_get_tile_summary(const TileCoordsXY& tileMin, const TileCoordsXY& tileMax)
+{
+    if (_tileSummariesAllDirty)
+    {
+        MarkAllTileSummariesDirty();
+    }
+
+    TileSummary summary;
+    const int32_t minX = std::max(tileMin.x, 0);
+    const int32_t minY = std::max(tileMin.y, 0);
+    const int32_t maxX = std::min(tileMax.x, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    const int32_t maxY = std::min(tileMax.y, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+    if (minX > maxX || minY > maxY)
+        return summary;
+
+    for (int32_t blockY = minY / TileSummaryBlockSize; blockY <= maxY / TileSummaryBlockSize; blockY++)
+    {
+        const int32_t blockMinY = blockY * TileSummaryBlockSize;
+        const int32_t blockMaxY = blockMinY + TileSummaryBlockSize - 1;
+        for (int32_t blockX = minX / TileSummaryBlockSize; blockX <= maxX / TileSummaryBlockSize; blockX++)
+        {
+            const int32_t blockMinX = blockX * TileSummaryBlockSize;
+            const int32_t blockMaxX = blockMinX + TileSummaryBlockSize - 1;
+
+            UpdateTileSummaryBlock(blockX, blockY);
+            if (blockMinX >= minX && blockMaxX <= maxX && blockMinY >= minY && blockMaxY <= maxY)
+            {
+                const auto& blockSummary = GetTileSummaryBlock(blockX, blockY).Summary;
+                summary.NumScenery += blockSummary.NumScenery;
+                summary.NumFountains += blockSummary.NumFountains;
+                summary.NumBrokenAdditions += blockSummary.NumBrokenAdditions;
+                summary.HasMissingAddition |= blockSummary.HasMissingAddition;
+                summary.TrackRides |= blockSummary.TrackRides;
+                continue;
+            }
+
+            for (int32_t y = std::max(blockMinY, minY); y <= std::min(blockMaxY, maxY); y++)
+            {
+                for (int32_t x = std::max(blockMinX, minX); x <= std::min(blockMaxX, maxX); x++)
+                {
+                    AddTileSummaryEntry(summary, x, y);
+                }
+            }
+        }
+    }
+    return summary;
+}
+
+/**
+ * Marks the summary of a tile as out of date. Anything that adds, removes or modifies tile elements has to call this
+ * (directly or through map_invalidate_tile and friends) or guests will keep seeing the old contents of the tile.
+ */
+void map_invalidate_tile_summary(const CoordsXY& loc)
+{
+    if (_tileSummariesAllDirty || !map_is_location_valid(loc))
+        return;
+
+    const auto tileLoc = TileCoordsXY(loc);
+    GetTileSummaryEntry(tileLoc.x, tileLoc.y).Dirty = true;
+    GetTileSummaryBlock(tileLoc.x / TileSummaryBlockSize, tileLoc.y / TileSummaryBlockSize).Dirty = true;
+}
+
+void map_invalidate_all_tile_summaries()
+{
+    _tileSummariesAllDirty = true;
+}
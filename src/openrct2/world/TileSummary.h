@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../ride/Ride.h"
+#include "Location.hpp"
+
+#include <bitset>
+
+/**
+ * What guests look at when judging their surroundings or picking a ride, summed over a range of tiles. Counts wrap
+ * around the same way the counters in the original tile walks did.
+ */
+struct TileSummary
+{
+    uint16_t NumScenery{};
+    uint16_t NumFountains{};
+    uint16_t NumBrokenAdditions{};
+    // A path addition whose object is not loaded
+    bool HasMissingAddition{};
+    std::bitset<MAX_RIDES> TrackRides;
+};
+
+/**
+ * Returns the summary of all tiles from tileMin to tileMax inclusive, clamped to the map.
+ */
+TileSummary map_get_tile_summary(const TileCoordsXY& tileMin, const TileCoordsXY& tileMax);
+
+void map_invalidate_tile_summary(const CoordsXY& loc);
+void map_invalidate_all_tile_summaries();
@@ -56,3 +56,18 @@ TEST_F(ImageImporterTests, Import_Logo)
     auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
     ASSERT_EQ(0xCEF27C7D, hash);
 }
+
+TEST_F(ImageImporterTests, Import_Logo_Dithering)
+{
+    auto logoPath = GetImagePath("logo.png");
+
+    ImageImporter importer;
+    auto image = Imaging::ReadFromFile(logoPath, IMAGE_FORMAT::PNG_32);
+    auto result = importer.Import(image, 0, 0, ImageImporter::IMPORT_FLAGS::RLE, ImageImporter::IMPORT_MODE::DITHERING);
+
+    // Check to ensure the chosen palette indices don't change unexpectedly.
+    // Update expected hash if change is expected.
+    ASSERT_NE(nullptr, result.Buffer.data());
+    auto hash = GetHash(result.Buffer.data(), result.Buffer.size());
+    ASSERT_EQ(0xDF3DA4DC, hash);
+}
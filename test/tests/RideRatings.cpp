@@ -14,12 +14,14 @@
 #include <openrct2/Game.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/audio/AudioContext.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/platform.h>
 #include <openrct2/ride/Ride.h>
 #include <openrct2/ride/RideData.h>
+#include <openrct2/ride/RideRatings.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -52,6 +54,24 @@ protected:
             static_cast<int>(ratings.Intensity), static_cast<int>(ratings.Nausea));
         return line;
     }
+
+    void CheckRatings()
+    {
+        // Load expected ratings
+        auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
+        auto expectedRatings = File::ReadAllLines(expectedDataPath);
+
+        // Check ride ratings
+        int expI = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            auto actual = FormatRatings(ride);
+            auto expected = expectedRatings[expI];
+            ASSERT_STREQ(actual.c_str(), expected.c_str());
+
+            expI++;
+        }
+    }
 };
 
 TEST_F(RideRatings, all)
@@ -72,19 +92,28 @@ TEST_F(RideRatings, all)
     ASSERT_EQ(ride_get_count(), 134);
 
     CalculateRatingsForAllRides();
+    CheckRatings();
+}
 
-    // Load expected ratings
-    auto expectedDataPath = Path::Combine(TestData::GetBasePath(), "ratings", "bpb.sv6.txt");
-    auto expectedRatings = File::ReadAllLines(expectedDataPath);
+TEST_F(RideRatings, recalculate_all_parallel)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
 
-    // Check ride ratings
-    int expI = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto actual = FormatRatings(ride);
-        auto expected = expectedRatings[expI];
-        ASSERT_STREQ(actual.c_str(), expected.c_str());
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
 
-        expI++;
-    }
+    core_init();
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    ASSERT_TRUE(initialised);
+
+    load_from_sv6(path.c_str());
+
+    // Check ride count to check load was successful
+    ASSERT_EQ(ride_get_count(), 134);
+
+    gConfigGeneral.multithreading = true;
+    ride_ratings_recalculate_all();
+    gConfigGeneral.multithreading = false;
+    CheckRatings();
 }